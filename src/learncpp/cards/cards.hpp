@@ -0,0 +1,157 @@
+//
+//  cards.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef cards_hpp
+#define cards_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+
+/**
+ * The playing card model shared by every card game in the project.
+ *
+ * Everything here is constexpr: the rank, suit and value tables, the card
+ * itself and the ordered deck, which the compiler builds once so that a
+ * game starts a deck by copying it rather than by filling it in a loop.
+ */
+namespace cards
+{
+    constexpr int ranksInASuit{ 13 };
+    constexpr int suitsInADeck{ 4 };
+    constexpr int cardsInADeck{ ranksInASuit * suitsInADeck };
+
+    // Indexed by rank, two to ace
+    constexpr char rankSymbols[ranksInASuit]{ '2', '3', '4', '5', '6', '7', '8', '9', 'T', 'J', 'Q', 'K', 'A' };
+    constexpr int rankValues[ranksInASuit]{ 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10, 11 };
+
+    // Indexed by suit
+    constexpr char suitSymbols[suitsInADeck]{ 'C', 'D', 'H', 'S' };
+
+
+    class Card
+    {
+    public:
+        // One byte each, so a whole card is two bytes
+        enum Rank : std::uint8_t
+        {
+            rank_two,
+            rank_three,
+            rank_four,
+            rank_five,
+            rank_six,
+            rank_seven,
+            rank_eight,
+            rank_nine,
+            rank_ten,
+            rank_jack,
+            rank_queen,
+            rank_king,
+            rank_ace,
+
+            max_rank
+        };
+        enum Suit : std::uint8_t
+        {
+            suit_clubs,
+            suit_diamonds,
+            suit_hearts,
+            suit_spades,
+
+            max_suits
+        };
+
+    private:
+        Rank m_rank{};
+        Suit m_suit{};
+
+    public:
+        Card() = default;
+
+        constexpr Card(Rank rank, Suit suit)
+            : m_rank{ rank }, m_suit{ suit }
+        {
+        }
+
+        // Characters a card takes as text: rank then suit, e.g. "TH"
+        static constexpr std::size_t textSize{ 2 };
+
+        constexpr Rank rank() const { return m_rank; }
+
+        constexpr Suit suit() const { return m_suit; }
+
+        // Blackjack value, an ace counting 11
+        constexpr int value() const { return rankValues[m_rank]; }
+
+        constexpr char rankSymbol() const { return rankSymbols[m_rank]; }
+
+        constexpr char suitSymbol() const { return suitSymbols[m_suit]; }
+
+        /**
+         * Writes the card's text (the same as `print()`) at `out` and returns
+         * the position after it
+         */
+        constexpr char *format(char *out) const
+        {
+            out[0] = rankSymbol();
+            out[1] = suitSymbol();
+            return out + textSize;
+        }
+
+        void print() const
+        {
+            char text[textSize];
+            std::cout.write(text, format(text) - text);
+        }
+    };
+
+    static_assert(sizeof(Card) == 2, "a card is one byte of rank and one of suit");
+    static_assert(ranksInASuit == Card::max_rank and suitsInADeck == Card::max_suits, "tables cover every card");
+
+
+    using FullDeck = std::array<Card, cardsInADeck>;
+
+    // Every card once, suit by suit and two to ace within a suit
+    constexpr FullDeck makeOrderedDeck()
+    {
+        FullDeck deck{};
+        for (int s{0}; s < suitsInADeck; s++)
+        {
+            for (int r{0}; r < ranksInASuit; r++)
+                deck[s * ranksInASuit + r] = { static_cast<Card::Rank>(r), static_cast<Card::Suit>(s) };
+        }
+        return deck;
+    }
+
+    // The ordered deck, built at compile time
+    constexpr FullDeck orderedDeck{ makeOrderedDeck() };
+
+    static_assert(orderedDeck[0].rank() == Card::rank_two and orderedDeck[0].suit() == Card::suit_clubs, "");
+    static_assert(orderedDeck[cardsInADeck - 1].rank() == Card::rank_ace and
+                  orderedDeck[cardsInADeck - 1].suit() == Card::suit_spades, "");
+
+
+    /**
+     * Writes the cards in [first, last) at `out`, each followed by
+     * `separator`, and returns the position after the last one. `out` needs
+     * room for `(last - first) * (Card::textSize + 1)` characters.
+     */
+    inline char *formatCards(char *out, const Card *first, const Card *last, char separator = '\t')
+    {
+        for (; first != last; ++first)
+        {
+            out = first->format(out);
+            *out++ = separator;
+        }
+        return out;
+    }
+}
+
+#endif /* cards_hpp */
@@ -0,0 +1,247 @@
+//
+//  basic_strategy.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef basic_strategy_hpp
+#define basic_strategy_hpp
+
+#include "globals.cpp"
+#include "strategy_table.hpp"
+
+#include <algorithm>
+#include <array>
+
+
+// Card classes by value, class `value - 2`: 2..10 are classes 0..8 and the
+// ace (valued 11) is class 9
+constexpr int cardClasses{ 10 };
+constexpr int aceClass{ cardClasses - 1 };
+
+using CardWeights = std::array<double, cardClasses>;
+
+
+/**
+ * Returns the probability of each card class when drawing from full decks.
+ */
+inline CardWeights fullDeckWeights()
+{
+    CardWeights weights{};
+    weights.fill(4.0 / Global::cardsInADeck);
+    weights[10 - 2] = 16.0 / Global::cardsInADeck;
+    return weights;
+}
+
+
+/**
+ * The house rules a strategy is computed for.
+ */
+struct StrategyRules
+{
+    int dealerStandsOn{ Global::maxDealerValue };
+    bool dealerHitsSoft17{ false };
+    bool lateSurrender{ false };
+
+    bool dealerStands(int score, bool isSoft) const
+    {
+        if (dealerHitsSoft17 and isSoft and score == dealerStandsOn)
+            return false;
+        return score >= dealerStandsOn;
+    }
+};
+
+
+/**
+ * Adds a card of value `cardValue` to a hand the way `Player::addCard()`
+ * does, an ace counting 11 until that would bust the hand.
+ */
+inline void addCardValue(int &score, bool &isSoft, int cardValue)
+{
+    int aces{ (isSoft ? 1 : 0) + (cardValue == 11 ? 1 : 0) };
+    score += cardValue;
+
+    if (score > Global::blackJack and aces > 0)
+    {
+        score -= 10;
+        aces -= 1;
+    }
+    isSoft = aces > 0;
+}
+
+
+/**
+ * Computes the optimal hit/stand decision for every player total and dealer
+ * upcard by exact expected value dynamic programming.
+ *
+ * The dealer's final total distribution is computed once per upcard, then
+ * the player's best EV is solved over (score, soft) states. Every state's
+ * hard count only grows when a card is added, so the recursion always ends
+ * and each state is solved once.
+ */
+class BasicStrategyGenerator
+{
+public:
+    // Probability of the dealer finishing on each total, the last entry
+    // being the probability of going bust
+    using DealerDistribution = std::array<double, Global::blackJack + 2>;
+    static constexpr int dealerBust{ Global::blackJack + 1 };
+
+private:
+    StrategyRules m_rules{};
+    CardWeights m_weights{};
+
+    std::array<std::array<DealerDistribution, 2>, Global::blackJack + 1> m_dealer{};
+    std::array<std::array<bool, 2>, Global::blackJack + 1> m_dealerDone{};
+
+    std::array<std::array<double, 2>, Global::blackJack + 1> m_best{};
+    std::array<std::array<bool, 2>, Global::blackJack + 1> m_bestDone{};
+    const DealerDistribution *m_upcardDealer{ nullptr };
+
+    const DealerDistribution &dealerFinal(int score, bool isSoft)
+    {
+        auto &distribution{ m_dealer[score][isSoft] };
+        if (m_dealerDone[score][isSoft])
+            return distribution;
+
+        distribution.fill(0.0);
+        if (m_rules.dealerStands(score, isSoft))
+            distribution[score] = 1.0;
+        else
+        {
+            for (int c{0}; c < cardClasses; c++)
+            {
+                int nextScore{ score };
+                bool nextSoft{ isSoft };
+                addCardValue(nextScore, nextSoft, c + 2);
+
+                if (nextScore > Global::blackJack)
+                    distribution[dealerBust] += m_weights[c];
+                else
+                {
+                    const auto &next{ dealerFinal(nextScore, nextSoft) };
+                    for (int t{0}; t <= dealerBust; t++)
+                        distribution[t] += m_weights[c] * next[t];
+                }
+            }
+        }
+
+        m_dealerDone[score][isSoft] = true;
+        return distribution;
+    }
+
+    double bestEv(int score, bool isSoft)
+    {
+        if (score > Global::blackJack)
+            return -1.0;
+        if (not m_bestDone[score][isSoft])
+        {
+            m_best[score][isSoft] = (score == Global::blackJack)
+                ? standEv(score)
+                : std::max(standEv(score), hitEv(score, isSoft));
+            m_bestDone[score][isSoft] = true;
+        }
+        return m_best[score][isSoft];
+    }
+
+public:
+    explicit BasicStrategyGenerator(const StrategyRules &rules = {},
+                                    const CardWeights &weights = fullDeckWeights())
+        : m_rules{ rules }, m_weights{ weights }
+    {
+    }
+
+    /**
+     * Returns the distribution of the dealer's final total for an upcard.
+     */
+    DealerDistribution dealerDistribution(int dealerUpcard)
+    {
+        return dealerFinal(dealerUpcard, dealerUpcard == 11);
+    }
+
+    /**
+     * Selects the upcard the player EVs below are computed against.
+     */
+    void setUpcard(int dealerUpcard)
+    {
+        m_upcardDealer = &dealerFinal(dealerUpcard, dealerUpcard == 11);
+        for (auto &row : m_bestDone)
+            row.fill(false);
+    }
+
+    double standEv(int score) const
+    {
+        if (score > Global::blackJack)
+            return -1.0;
+
+        const auto &dealer{ *m_upcardDealer };
+        double ev{ dealer[dealerBust] };
+        for (int t{0}; t <= Global::blackJack; t++)
+        {
+            if (t < score)
+                ev += dealer[t];
+            else if (t > score)
+                ev -= dealer[t];
+        }
+        return ev;
+    }
+
+    double hitEv(int score, bool isSoft)
+    {
+        double ev{ 0.0 };
+        for (int c{0}; c < cardClasses; c++)
+        {
+            int nextScore{ score };
+            bool nextSoft{ isSoft };
+            addCardValue(nextScore, nextSoft, c + 2);
+            ev += m_weights[c] * bestEv(nextScore, nextSoft);
+        }
+        return ev;
+    }
+
+    /**
+     * Returns the EV of a fresh hand played perfectly: one player card and
+     * the dealer's upcard dealt from the same distribution.
+     */
+    double handEv()
+    {
+        double ev{ 0.0 };
+        for (int up{0}; up < cardClasses; up++)
+        {
+            setUpcard(up + 2);
+            for (int first{0}; first < cardClasses; first++)
+                ev += m_weights[up] * m_weights[first] * bestEv(first + 2, first == aceClass);
+        }
+        return ev;
+    }
+
+    /**
+     * Returns the full decision table, hitting wherever hitting has the
+     * strictly higher EV, and, if the rules allow late surrender,
+     * surrendering hard totals whose best EV is worse than losing half the
+     * bet.
+     */
+    StrategyTable table()
+    {
+        StrategyTable table{};
+        for (int up{2}; up <= 11; up++)
+        {
+            setUpcard(up);
+            for (int score{2}; score < Global::blackJack; score++)
+            {
+                double hardHit{ hitEv(score, false) };
+                if (hardHit > standEv(score))
+                    table.hard[score] |= static_cast<std::uint16_t>(1u << up);
+                if (m_rules.lateSurrender and std::max(hardHit, standEv(score)) < -0.5)
+                    table.surrender[score] |= static_cast<std::uint16_t>(1u << up);
+                if (score >= 11 and hitEv(score, true) > standEv(score))
+                    table.soft[score] |= static_cast<std::uint16_t>(1u << up);
+            }
+        }
+        return table;
+    }
+};
+
+#endif /* basic_strategy_hpp */
@@ -0,0 +1,26 @@
+//
+//  basic_strategy_table.hpp
+//  learncpp
+//
+//  Generated by generate_strategy.cpp, do not edit by hand.
+//  Dealer stands on 17, stands on soft 17, no surrender, full deck card weights.
+//
+
+#ifndef basic_strategy_table_hpp
+#define basic_strategy_table_hpp
+
+#include "strategy_table.hpp"
+
+
+// Row = player total, bit = dealer upcard (2 to 11), set = hit
+constexpr StrategyTable basicStrategyTable
+{
+    // hard totals
+    {{ 0x0000, 0x0000, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0f8c, 0x0f80, 0x0f80, 0x0f80, 0x0f80, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }},
+    // soft totals
+    {{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0ffc, 0x0e00, 0x0000, 0x0000, 0x0000 }},
+    // hard totals to surrender, where the rules allow it
+    {{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }}
+};
+
+#endif /* basic_strategy_table_hpp */
@@ -0,0 +1,244 @@
+//
+//  benchmark_blackJack.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "player.cpp"
+#include "simulation.hpp"
+#include "basic_strategy_table.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+
+// Every allocation made by the process goes through here, so a benchmark
+// can tell how many allocations its operation makes
+std::atomic<long long> allocationCount{ 0 };
+
+void *operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory{ std::malloc(size ? size : 1) })
+        return memory;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+
+/**
+ * Keeps the compiler from dropping a computation whose result is unused.
+ */
+template <typename T>
+inline void doNotOptimize(const T &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+
+struct BenchmarkResult
+{
+    std::string name;
+    long long opsPerRepetition{ 0 };
+    int repetitions{ 0 };
+    double nsPerOp{ 0.0 };        // median over the repetitions
+    double minNsPerOp{ 0.0 };
+    double opsPerSecond{ 0.0 };
+    double allocationsPerOp{ 0.0 };
+};
+
+
+/**
+ * Times `body`, which performs `ops` operations per call.
+ *
+ * The body first runs `warmUp` times untimed, to settle caches and branch
+ * predictors, then `repetitions` times timed. The median repetition gives
+ * the reported ns/op so that one slow repetition does not skew it.
+ */
+template <typename Body>
+BenchmarkResult runBenchmark(const std::string &name, long long ops, int warmUp, int repetitions, Body body)
+{
+    for (int i{0}; i < warmUp; i++)
+        body();
+
+    std::vector<double> nsPerOp(repetitions);
+    long long allocationsBefore{ allocationCount.load() };
+
+    for (int i{0}; i < repetitions; i++)
+    {
+        auto start{ std::chrono::steady_clock::now() };
+        body();
+        std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start };
+        nsPerOp[i] = elapsed.count() / ops;
+    }
+
+    long long allocations{ allocationCount.load() - allocationsBefore };
+    std::vector<double> sorted{ nsPerOp };
+    std::sort(sorted.begin(), sorted.end());
+
+    BenchmarkResult result{};
+    result.name = name;
+    result.opsPerRepetition = ops;
+    result.repetitions = repetitions;
+    result.nsPerOp = sorted[sorted.size() / 2];
+    result.minNsPerOp = sorted.front();
+    result.opsPerSecond = 1e9 / result.nsPerOp;
+    result.allocationsPerOp = static_cast<double>(allocations) / (static_cast<double>(ops) * repetitions);
+    return result;
+}
+
+
+void printTable(const std::vector<BenchmarkResult> &results)
+{
+    std::cout << std::left << std::setw(20) << "benchmark"
+              << std::right << std::setw(12) << "ns/op" << std::setw(12) << "min ns/op"
+              << std::setw(16) << "ops/sec" << std::setw(12) << "allocs/op" << "\n";
+
+    std::cout << std::fixed;
+    for (const auto &result : results)
+    {
+        std::cout << std::left << std::setw(20) << result.name << std::right
+                  << std::setprecision(2) << std::setw(12) << result.nsPerOp
+                  << std::setw(12) << result.minNsPerOp
+                  << std::setprecision(0) << std::setw(16) << result.opsPerSecond
+                  << std::setprecision(3) << std::setw(12) << result.allocationsPerOp << "\n";
+    }
+}
+
+void printJson(const std::vector<BenchmarkResult> &results)
+{
+    std::cout << "{\n  \"benchmarks\": [\n";
+    for (std::size_t i{0}; i < results.size(); i++)
+    {
+        const auto &result{ results[i] };
+        std::cout << "    {\"name\": \"" << result.name << "\""
+                  << ", \"ops_per_repetition\": " << result.opsPerRepetition
+                  << ", \"repetitions\": " << result.repetitions
+                  << ", \"ns_per_op\": " << result.nsPerOp
+                  << ", \"min_ns_per_op\": " << result.minNsPerOp
+                  << ", \"ops_per_second\": " << result.opsPerSecond
+                  << ", \"allocations_per_op\": " << result.allocationsPerOp << "}"
+                  << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    std::cout << "  ]\n}\n";
+}
+
+
+// Usage: benchmark_blackJack [--json] [repetitions]
+int main(int argc, char *argv[])
+{
+    bool json{ false };
+    int repetitions{ 15 };
+    for (int i{1}; i < argc; i++)
+    {
+        if (std::string{ argv[i] } == "--json")
+            json = true;
+        else
+            repetitions = std::max(1, std::atoi(argv[i]));
+    }
+
+    constexpr int warmUp{ 3 };
+    constexpr long long ops{ 1 << 20 };
+    constexpr std::uint64_t seed{ 2026 };
+
+    std::vector<BenchmarkResult> results;
+
+    // One of every card, looked up over and over
+    Card cards[Global::cardsInADeck];
+    for (int i{0}; i < Global::cardsInADeck; i++)
+        cards[i] = { static_cast<Card::Rank>(i % Global::cardInASuit),
+                     static_cast<Card::Suit>(i / Global::cardInASuit) };
+
+    results.push_back(runBenchmark("Card::value", ops, warmUp, repetitions, [&cards]()
+    {
+        int total{ 0 };
+        for (long long i{0}; i < ops; i++)
+        {
+            doNotOptimize(cards);
+            total += cards[i % Global::cardsInADeck].value();
+        }
+        doNotOptimize(total);
+    }));
+
+    Deck deck{ seed };
+    deck.shuffle();
+
+    results.push_back(runBenchmark("Deck::shuffle", ops / 64, warmUp, repetitions, [&deck]()
+    {
+        for (long long i{0}; i < ops / 64; i++)
+        {
+            deck.shuffle();
+            doNotOptimize(deck);
+        }
+    }));
+
+    results.push_back(runBenchmark("Deck::format", ops / 64, warmUp, repetitions, [&deck]()
+    {
+        char text[Deck::formattedSize];
+        for (long long i{0}; i < ops / 64; i++)
+        {
+            doNotOptimize(deck.format(text));
+            doNotOptimize(text);
+        }
+    }));
+
+    results.push_back(runBenchmark("Deck::dealCard", ops, warmUp, repetitions, [&deck]()
+    {
+        for (long long i{0}; i < ops; i++)
+            doNotOptimize(deck.dealCard());
+    }));
+
+    // Per card cost of dealing in batches of 8
+    results.push_back(runBenchmark("Deck::deal(8)", ops, warmUp, repetitions, [&deck]()
+    {
+        for (long long i{0}; i < ops / 8; i++)
+            doNotOptimize(deck.deal(8));
+    }));
+
+    results.push_back(runBenchmark("Player::drawCard", ops, warmUp, repetitions, [&deck]()
+    {
+        Player player{};
+        for (long long i{0}; i < ops; i++)
+        {
+            // Start a new hand once bust so scores stay in range
+            if (player.isBust())
+                player = Player{};
+            doNotOptimize(player.drawCard(deck));
+        }
+    }));
+
+    // A complete hand: the headless `play()` of both seats with basic strategy
+    results.push_back(runBenchmark("playHand", ops / 8, warmUp, repetitions, [&deck]()
+    {
+        TableStrategy strategy{ basicStrategyTable };
+        SimulationResult result{};
+        for (long long i{0}; i < ops / 8; i++)
+            doNotOptimize(playHand(deck, strategy, result));
+    }));
+
+    if (json)
+        printJson(results);
+    else
+        printTable(results);
+    return 0;
+}
@@ -0,0 +1,200 @@
+//
+//  blackJack_client.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+/**
+ * Returns a socket connected to the server at `path`, or -1
+ */
+int connectTo(const char *path)
+{
+    sockaddr_un address{};
+    if (std::strlen(path) >= sizeof(address.sun_path))
+        return -1;
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, path);
+
+    int fd{ ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0) };
+    if (fd >= 0 and ::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)
+    {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * Plays at the table by hand: the server's text goes to the terminal and
+ * the terminal's lines go to the server.
+ */
+int playInteractively(const char *path)
+{
+    int fd{ connectTo(path) };
+    if (fd < 0)
+    {
+        std::cout << "[ERROR] - Could not connect to " << path << "\n";
+        return 1;
+    }
+
+    pollfd fds[2]{ { fd, POLLIN, 0 }, { STDIN_FILENO, POLLIN, 0 } };
+    char buffer[4096];
+    while (::poll(fds, 2, -1) > 0)
+    {
+        if (fds[0].revents)
+        {
+            ssize_t count{ ::recv(fd, buffer, sizeof(buffer), 0) };
+            if (count <= 0)
+                break;
+            std::cout.write(buffer, count).flush();
+        }
+        if (fds[1].revents)
+        {
+            ssize_t count{ ::read(STDIN_FILENO, buffer, sizeof(buffer)) };
+            if (count > 0)
+                ::send(fd, buffer, static_cast<std::size_t>(count), MSG_NOSIGNAL);
+            else
+            {
+                // Out of input: let the server see the end and print the
+                // rest of what it has to say
+                ::shutdown(fd, SHUT_WR);
+                fds[1].fd = -1;
+            }
+        }
+    }
+    ::close(fd);
+    std::cout << "\n";
+    return 0;
+}
+
+
+/**
+ * A scripted player: hits below 17 and leaves the table after its hands.
+ */
+struct Bot
+{
+    int fd{ -1 };
+    std::string text;           // received since the last answer
+    int handsLeft{ 0 };
+    bool done{ false };
+};
+
+/**
+ * Returns the answer `bot` gives to the question at the end of its text,
+ * or '\0' if no question has been asked yet
+ */
+char answerFor(Bot &bot)
+{
+    static const std::string hitPrompt{ "Do you want to hit? (y/n): " };
+    static const std::string againPrompt{ "Play another hand? (y/n): " };
+    static const std::string scoreText{ "player's score: " };
+
+    auto endsWith = [&bot](const std::string &suffix)
+    {
+        return bot.text.size() >= suffix.size() and
+               bot.text.compare(bot.text.size() - suffix.size(), suffix.size(), suffix) == 0;
+    };
+
+    if (endsWith(hitPrompt))
+    {
+        std::size_t at{ bot.text.rfind(scoreText) };
+        int score{ std::atoi(bot.text.c_str() + at + scoreText.size()) };
+        return score < Global::maxDealerValue ? 'y' : 'n';
+    }
+    if (endsWith(againPrompt))
+        return --bot.handsLeft > 0 ? 'y' : 'n';
+    return '\0';
+}
+
+/**
+ * Opens `bots` connections at once and plays `hands` hands on each, to load
+ * the server with many concurrent tables.
+ */
+int runBots(const char *path, int bots, int hands)
+{
+    std::vector<Bot> players(bots);
+    std::vector<pollfd> fds(bots);
+    for (int i{0}; i < bots; i++)
+    {
+        players[i].fd = connectTo(path);
+        players[i].handsLeft = hands;
+        if (players[i].fd < 0)
+        {
+            std::cout << "[ERROR] - Connection " << i << " to " << path << " failed\n";
+            return 1;
+        }
+        fds[i] = { players[i].fd, POLLIN, 0 };
+    }
+
+    auto start{ std::chrono::steady_clock::now() };
+    long long handsPlayed{ 0 };
+    int open{ bots };
+    char buffer[4096];
+
+    while (open > 0 and ::poll(fds.data(), fds.size(), 5000) > 0)
+    {
+        for (int i{0}; i < bots; i++)
+        {
+            if (not fds[i].revents)
+                continue;
+
+            Bot &bot{ players[i] };
+            ssize_t count{ ::recv(bot.fd, buffer, sizeof(buffer), 0) };
+            if (count <= 0)
+            {
+                ::close(bot.fd);
+                fds[i].fd = -1;
+                bot.done = true;
+                --open;
+                continue;
+            }
+            bot.text.append(buffer, static_cast<std::size_t>(count));
+
+            if (char answer{ answerFor(bot) })
+            {
+                if (bot.text.find("Play another hand") != std::string::npos)
+                    ++handsPlayed;
+                char line[2]{ answer, '\n' };
+                ::send(bot.fd, line, sizeof(line), MSG_NOSIGNAL);
+                bot.text.clear();
+            }
+        }
+    }
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "[INFO] - Bots             = " << bots << (open ? " (some timed out)" : "") << "\n";
+    std::cout << "[INFO] - Hands played     = " << handsPlayed << "\n";
+    std::cout << "[INFO] - Hands / second   = " << static_cast<long long>(handsPlayed / elapsed.count()) << "\n";
+    return open ? 1 : 0;
+}
+
+// Usage: blackJack_client [socket path]
+//        blackJack_client --bots <connections> [hands each] [socket path]
+int main(int argc, char *argv[])
+{
+    if (argc > 2 and std::string{ argv[1] } == "--bots")
+    {
+        int bots{ std::atoi(argv[2]) };
+        int hands{ argc > 3 ? std::atoi(argv[3]) : 10 };
+        return runBots(argc > 4 ? argv[4] : "/tmp/blackjack.sock", bots, hands);
+    }
+    return playInteractively(argc > 1 ? argv[1] : "/tmp/blackjack.sock");
+}
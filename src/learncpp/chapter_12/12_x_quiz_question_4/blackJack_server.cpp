@@ -0,0 +1,320 @@
+//
+//  blackJack_server.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "player.cpp"
+#include "blackJack_session.hpp"
+
+#include <csignal>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+/**
+ * One client connection and the table it plays at.
+ */
+struct Connection
+{
+    int fd{ -1 };
+    BlackJackSession session;
+    bool reading{ true };       // EPOLLIN is armed
+    bool writing{ false };      // EPOLLOUT is armed
+    bool hungUp{ false };       // the client will send nothing more
+
+    Connection(int socket, std::uint64_t seed)
+        : fd{ socket }, session{ seed }
+    {
+    }
+};
+
+
+/**
+ * Single threaded epoll loop serving blackjack sessions on a Unix socket.
+ *
+ * Every socket is non-blocking; a connection is only touched when epoll
+ * says it is readable or, while it has replies pending, writable. No
+ * session can hold up another, so one thread keeps thousands of tables
+ * going.
+ */
+class BlackJackServer
+{
+private:
+    int m_listenFd{ -1 };
+    int m_epollFd{ -1 };
+    std::vector<std::unique_ptr<Connection>> m_connections;     // indexed by fd
+    std::uint64_t m_nextSeed{ 0 };
+    long long m_open{ 0 };
+    long long m_served{ 0 };
+    bool m_accepting{ true };   // the listening socket is in the epoll set
+
+    void watch(int fd, std::uint32_t events, int operation)
+    {
+        epoll_event event{};
+        event.events = events;
+        event.data.fd = fd;
+        ::epoll_ctl(m_epollFd, operation, fd, &event);
+    }
+
+    void closeConnection(Connection &connection)
+    {
+        int fd{ connection.fd };
+        ::epoll_ctl(m_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+        ::close(fd);
+        m_connections[fd].reset();
+        --m_open;
+
+        // A descriptor is free again, so new connections can be taken
+        if (not m_accepting)
+        {
+            m_accepting = true;
+            watch(m_listenFd, EPOLLIN, EPOLL_CTL_ADD);
+        }
+    }
+
+    void acceptConnections()
+    {
+        while (true)
+        {
+            int fd{ ::accept4(m_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC) };
+            if (fd < 0)
+            {
+                if (errno == EINTR or errno == ECONNABORTED)
+                    continue;
+
+                // Out of descriptors the pending connection stays queued and
+                // the listening socket stays readable, so stop watching it
+                // until a connection closes rather than spin on it
+                if (errno == EMFILE or errno == ENFILE or errno == ENOBUFS or errno == ENOMEM)
+                {
+                    m_accepting = false;
+                    ::epoll_ctl(m_epollFd, EPOLL_CTL_DEL, m_listenFd, nullptr);
+                    std::cout << "[ERROR] - Not accepting connections: " << std::strerror(errno) << "\n";
+                }
+                return;
+            }
+
+            if (static_cast<std::size_t>(fd) >= m_connections.size())
+                m_connections.resize(fd + 1);
+            m_connections[fd] = std::make_unique<Connection>(fd, m_nextSeed++);
+            ++m_open;
+            ++m_served;
+
+            // The welcome and first hand are ready straight away
+            watch(fd, EPOLLIN, EPOLL_CTL_ADD);
+            flush(*m_connections[fd]);
+        }
+    }
+
+    // Watches for input only while the client may still send some and the
+    // pending output is under the limit, and for writability only while
+    // there is output pending
+    void updateEvents(Connection &connection)
+    {
+        std::size_t pending{ connection.session.output().size() };
+        bool wantRead{ not connection.hungUp and pending < BlackJackSession::maxPendingOutput };
+        bool wantWrite{ pending > 0 };
+        if (wantRead == connection.reading and wantWrite == connection.writing)
+            return;
+
+        connection.reading = wantRead;
+        connection.writing = wantWrite;
+
+        std::uint32_t events{ 0 };
+        if (wantRead)
+            events |= EPOLLIN;
+        if (wantWrite)
+            events |= EPOLLOUT;
+        watch(connection.fd, events, EPOLL_CTL_MOD);
+    }
+
+    // Sends as much pending output as the socket takes, and closes the
+    // connection once nothing is left to send to a finished or hung up
+    // client. Returns false once the connection has been closed.
+    bool flush(Connection &connection)
+    {
+        std::string &output{ connection.session.output() };
+        std::size_t sent{ 0 };
+        while (sent < output.size())
+        {
+            ssize_t count{ ::send(connection.fd, output.data() + sent, output.size() - sent, MSG_NOSIGNAL) };
+            if (count < 0)
+            {
+                if (errno == EAGAIN or errno == EWOULDBLOCK)
+                    break;
+                closeConnection(connection);
+                return false;
+            }
+            sent += static_cast<std::size_t>(count);
+        }
+        output.erase(0, sent);
+
+        if (output.empty() and (connection.hungUp or connection.session.state() == BlackJackSession::State::closed))
+        {
+            closeConnection(connection);
+            return false;
+        }
+
+        updateEvents(connection);
+        return true;
+    }
+
+    /**
+     * Plays what the client sent, until its socket is drained or the
+     * replies waiting for it pass `maxPendingOutput`. A client that sends
+     * answers without reading the replies then finds its input queued in
+     * the socket, so the pending output never grows past the limit by more
+     * than what one buffer of input produces. A client that shuts down its
+     * side still gets the replies already queued before it is closed.
+     */
+    void readFrom(Connection &connection)
+    {
+        char buffer[4096];
+        while (connection.session.output().size() < BlackJackSession::maxPendingOutput)
+        {
+            ssize_t count{ ::recv(connection.fd, buffer, sizeof(buffer), 0) };
+            if (count > 0)
+            {
+                connection.session.receive(buffer, static_cast<std::size_t>(count));
+                continue;
+            }
+            if (count < 0 and (errno == EAGAIN or errno == EWOULDBLOCK))
+                break;
+            if (count == 0)
+            {
+                connection.hungUp = true;
+                break;
+            }
+
+            // The socket failed
+            closeConnection(connection);
+            return;
+        }
+        flush(connection);
+    }
+
+public:
+    explicit BlackJackServer(std::uint64_t seed)
+        : m_nextSeed{ seed }
+    {
+    }
+
+    ~BlackJackServer()
+    {
+        for (auto &connection : m_connections)
+        {
+            if (connection)
+                ::close(connection->fd);
+        }
+        if (m_epollFd >= 0)
+            ::close(m_epollFd);
+        if (m_listenFd >= 0)
+            ::close(m_listenFd);
+    }
+
+    /**
+     * Binds the listening socket at `path`, replacing any stale socket file
+     */
+    bool listen(const char *path)
+    {
+        sockaddr_un address{};
+        if (std::strlen(path) >= sizeof(address.sun_path))
+            return false;
+        address.sun_family = AF_UNIX;
+        std::strcpy(address.sun_path, path);
+
+        m_listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        m_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+        if (m_listenFd < 0 or m_epollFd < 0)
+            return false;
+
+        ::unlink(path);
+        if (::bind(m_listenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 or
+            ::listen(m_listenFd, SOMAXCONN) < 0)
+            return false;
+
+        watch(m_listenFd, EPOLLIN, EPOLL_CTL_ADD);
+        return true;
+    }
+
+    /**
+     * Serves connections until `keepRunning` turns false
+     */
+    void run(volatile std::sig_atomic_t &keepRunning)
+    {
+        std::vector<epoll_event> events(1024);
+        while (keepRunning)
+        {
+            int ready{ ::epoll_wait(m_epollFd, events.data(), static_cast<int>(events.size()), 1000) };
+            for (int i{0}; i < ready; i++)
+            {
+                int fd{ events[i].data.fd };
+                if (fd == m_listenFd)
+                {
+                    acceptConnections();
+                    continue;
+                }
+
+                Connection *connection{ m_connections[fd].get() };
+                if (not connection)
+                    continue;
+
+                if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                    readFrom(*connection);
+                else if (events[i].events & EPOLLOUT)
+                    flush(*connection);
+            }
+        }
+    }
+
+    long long openConnections() const { return m_open; }
+    long long servedConnections() const { return m_served; }
+};
+
+
+volatile std::sig_atomic_t keepRunning{ 1 };
+
+void stopServer(int)
+{
+    keepRunning = 0;
+}
+
+// Usage: blackJack_server [socket path] [seed]
+int main(int argc, char *argv[])
+{
+    const char *path{ argc > 1 ? argv[1] : "/tmp/blackjack.sock" };
+    std::uint64_t seed{ argc > 2 ? std::strtoull(argv[2], nullptr, 10) : seedFromDevice() };
+
+    BlackJackServer server{ seed };
+    if (not server.listen(path))
+    {
+        std::cout << "[ERROR] - Could not listen on " << path << ": " << std::strerror(errno) << "\n";
+        return 1;
+    }
+
+    std::signal(SIGINT, stopServer);
+    std::signal(SIGTERM, stopServer);
+
+    std::cout << "[INFO] - Serving blackjack on " << path << "\n";
+    server.run(keepRunning);
+    std::cout << "\n[INFO] - Served " << server.servedConnections() << " connections\n";
+
+    ::unlink(path);
+    return 0;
+}
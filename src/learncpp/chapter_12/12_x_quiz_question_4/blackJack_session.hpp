@@ -0,0 +1,215 @@
+//
+//  blackJack_session.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef blackJack_session_hpp
+#define blackJack_session_hpp
+
+#include "globals.cpp"
+#include "deck.hpp"
+#include "player.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+/**
+ * One player's table, driven by text lines instead of `std::cin`.
+ *
+ * The session is a small state machine: it never waits for the player, it
+ * only reacts to the lines handed to `receive()` and queues its replies in
+ * `output()`, using the same text as the console game. That lets a server
+ * keep thousands of sessions on one thread and feed each one whenever its
+ * socket has data.
+ */
+class BlackJackSession
+{
+public:
+    enum class State
+    {
+        player_turn,    // waiting for a hit/stay answer
+        another_hand,   // waiting to know whether to deal again
+        closed,         // the player is done, close once output is sent
+    };
+
+    // Longest line accepted from the player
+    static constexpr std::size_t maxLine{ 256 };
+
+    // Unsent output past which the server stops reading from the player
+    // until the player has read some of it
+    static constexpr std::size_t maxPendingOutput{ 64 * 1024 };
+
+private:
+    Deck m_deck;
+    Player m_player{};
+    Player m_dealer{};
+    State m_state{ State::player_turn };
+    std::string m_input;
+    std::string m_output;
+    long long m_handsPlayed{ 0 };
+
+    void displayScore(int total, bool dealerIsPlaying)
+    {
+        m_output += dealerIsPlaying ? "\n\t[INFO] - dealer's score: " : "\n\t[INFO] - player's score: ";
+        m_output += std::to_string(total);
+    }
+
+    void printDealerAndPlayerValue(int playerValue, int dealerValue)
+    {
+        m_output += "\n\n[INFO] - Player's total card value = " + std::to_string(playerValue);
+        m_output += "\n[INFO] - Dealer's total card value = " + std::to_string(dealerValue);
+    }
+
+    void askToHit()
+    {
+        m_state = State::player_turn;
+        m_output += "\n\t[UserInput] - Do you want to hit? (y/n): ";
+    }
+
+    void askForAnotherHand()
+    {
+        m_state = State::another_hand;
+        m_output += "\n[UserInput] - Play another hand? (y/n): ";
+    }
+
+    void beginHand()
+    {
+        m_player = Player{};
+        m_dealer = Player{};
+
+        m_output += "\n\n[INFO] - It's the player's chance to play first.";
+        m_player.drawCard(m_deck);
+        displayScore(m_player.score(), false);
+
+        if (m_player.score() < Global::blackJack)
+            askToHit();
+        else
+            finishHand();
+    }
+
+    void hit()
+    {
+        m_player.drawCard(m_deck);
+        displayScore(m_player.score(), false);
+
+        if (m_player.score() < Global::blackJack)
+            askToHit();
+        else
+            finishHand();
+    }
+
+    // Plays the dealer's turn, if needed, and announces the winner
+    void finishHand()
+    {
+        ++m_handsPlayed;
+        int playerValue{ m_player.score() };
+
+        BlackJackResult result{};
+        if (playerValue > Global::blackJack)
+        {
+            printDealerAndPlayerValue(playerValue, 0);
+            result = BlackJackResult::dealer_won;
+        }
+        else
+        {
+            m_output += "\n\n[INFO] - The dealer will now play until 17 or bust.";
+            do
+            {
+                m_dealer.drawCard(m_deck);
+                displayScore(m_dealer.score(), true);
+            }
+            while (m_dealer.score() < Global::maxDealerValue);
+
+            int dealerValue{ m_dealer.score() };
+            printDealerAndPlayerValue(playerValue, dealerValue);
+
+            if (dealerValue > Global::blackJack or playerValue > dealerValue)
+                result = BlackJackResult::player_won;
+            else if (playerValue < dealerValue)
+                result = BlackJackResult::dealer_won;
+            else
+                result = BlackJackResult::tie;
+        }
+
+        if (result == BlackJackResult::player_won)
+            m_output += "\n[INFO] - Player won !\n";
+        else if (result == BlackJackResult::dealer_won)
+            m_output += "\n[INFO] - Dealer won !\n";
+        else
+            m_output += "\n[INFO] - The game is a tie !\n";
+
+        askForAnotherHand();
+    }
+
+    void handleLine(const std::string &line)
+    {
+        char answer{ line.empty() ? '\0' : line[0] };
+
+        if (m_state == State::player_turn)
+        {
+            if (answer == 'y')
+                hit();
+            else if (answer == 'n')
+                finishHand();
+            else
+                askToHit();
+        }
+        else if (m_state == State::another_hand)
+        {
+            if (answer == 'y')
+                beginHand();
+            else if (answer == 'n')
+            {
+                m_output += "[INFO] - Thanks for playing.\n";
+                m_state = State::closed;
+            }
+            else
+                askForAnotherHand();
+        }
+    }
+
+public:
+    explicit BlackJackSession(std::uint64_t seed)
+        : m_deck{ seed }
+    {
+        m_deck.shuffle();
+        m_output += "[INFO] - Welcome to the table.";
+        beginHand();
+    }
+
+    /**
+     * Takes bytes sent by the player. Every complete line is played as an
+     * answer to the last question; a line longer than `maxLine` closes the
+     * session.
+     */
+    void receive(const char *data, std::size_t size)
+    {
+        for (std::size_t i{0}; i < size and m_state != State::closed; i++)
+        {
+            if (data[i] == '\n')
+            {
+                handleLine(m_input);
+                m_input.clear();
+            }
+            else if (data[i] != '\r')
+            {
+                m_input += data[i];
+                if (m_input.size() > maxLine)
+                    m_state = State::closed;
+            }
+        }
+    }
+
+    // Text waiting to be sent to the player; the caller erases what it sent
+    std::string &output() { return m_output; }
+
+    State state() const { return m_state; }
+    long long handsPlayed() const { return m_handsPlayed; }
+};
+
+#endif /* blackJack_session_hpp */
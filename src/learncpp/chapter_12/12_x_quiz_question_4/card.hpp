@@ -9,57 +9,32 @@
 #ifndef card_hpp
 #define card_hpp
 
-#include <iostream>
+#include "../../cards/cards.hpp"
 
-class Card
-{
-public:
-    enum Rank
-    {
-        rank_two,
-        rank_three,
-        rank_four,
-        rank_five,
-        rank_six,
-        rank_seven,
-        rank_eight,
-        rank_nine,
-        rank_ten,
-        rank_jack,
-        rank_queen,
-        rank_king,
-        rank_ace,
-        
-        max_rank
-    };
-    enum Suit
-    {
-        suit_clubs,
-        suit_diamonds,
-        suit_hearts,
-        suit_spades,
-        
-        max_suits
-    };
-    
-private:
-    Rank m_rank{};
-    Suit m_suit{};
+#include <cstddef>
 
-public:
-    Card() = default;
-    
-    Card(Rank rank, Suit suit)
-        : m_rank{ rank }, m_suit{ suit }
-    {
-    }
-    
-    void print() const;
-    
-    int value() const;
 
+// The card model is the shared one of the `cards` library
+using Card = cards::Card;
+
+
+/**
+ * A run of contiguous cards, as handed out by a batch deal. Only valid until
+ * the deck or shoe it came from deals or shuffles again.
+ */
+struct CardSpan
+{
+    const Card *first{ nullptr };
+    const Card *last{ nullptr };
     
+    const Card *begin() const { return first; }
+    const Card *end() const { return last; }
+    std::size_t size() const { return static_cast<std::size_t>(last - first); }
+    const Card &operator[](std::size_t i) const { return first[i]; }
 };
 
 
+using cards::formatCards;
+
+
 #endif /* card_hpp */
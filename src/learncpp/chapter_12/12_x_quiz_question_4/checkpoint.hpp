@@ -0,0 +1,511 @@
+//
+//  checkpoint.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef checkpoint_hpp
+#define checkpoint_hpp
+
+#include "deck.hpp"
+#include "packed_card.hpp"
+#include "simulation.hpp"
+#include "parallel_simulation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+
+/**
+ * Binary checkpoint format of a parallel simulation run.
+ *
+ * Integers are little endian and fixed width. A file is:
+ *
+ *   "BJC1"                 magic
+ *   u8 + bytes             label of the run, e.g. the strategy it plays
+ *   u64 masterSeed, i64 hands, i64 nextChunk
+ *   result                 totals of every chunk finished
+ *   u32 + chunk states     chunks started but not finished, each:
+ *       i64 chunk, i64 handsPlayed, result, u8 cardIndex,
+ *       52 packed card codes, the engine's bytes
+ *   u64                    FNV-1a hash of everything before it
+ *
+ * where a result is its eight counts as i64 followed by the bits of
+ * `playerUnits`. An open chunk takes about 170 bytes, so a checkpoint
+ * stays well under a page per worker.
+ */
+namespace checkpoint
+{
+    constexpr char magic[4]{ 'B', 'J', 'C', '1' };
+
+    // Hands a worker plays between two looks at whether a checkpoint wants
+    // it to stop, well under a millisecond of play
+    constexpr long long handsPerSlice{ 1024 };
+
+    static_assert(std::is_trivially_copyable<Deck::State>::value, "deck state is copied as bytes");
+
+    /**
+     * A chunk some worker was in the middle of: how far it got, what it
+     * has won so far and the deck it was dealing from.
+     */
+    struct ChunkState
+    {
+        long long chunk{ 0 };
+        long long handsPlayed{ 0 };
+        SimulationResult result{};
+        Deck::State deck{};
+    };
+
+    /**
+     * Everything needed to carry on a run: the chunks already finished are
+     * summed in `finished`, the ones in progress are in `open` and every
+     * chunk from `nextChunk` on is still to be played.
+     */
+    struct RunState
+    {
+        std::string label;
+        std::uint64_t masterSeed{ 0 };
+        long long hands{ 0 };
+        long long nextChunk{ 0 };
+        SimulationResult finished{};
+        std::vector<ChunkState> open;
+
+        long long handsPlayed() const
+        {
+            long long played{ finished.hands };
+            for (const ChunkState &chunk : open)
+                played += chunk.result.hands;
+            return played;
+        }
+    };
+
+
+    inline void putFixed(std::vector<std::uint8_t> &out, std::uint64_t value, int bytes = 8)
+    {
+        for (int i{0}; i < bytes; i++)
+            out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+
+    inline std::uint64_t fnv1a(const std::uint8_t *data, std::size_t size)
+    {
+        std::uint64_t hash{ 0xCBF29CE484222325ULL };
+        for (std::size_t i{0}; i < size; i++)
+            hash = (hash ^ data[i]) * 0x100000001B3ULL;
+        return hash;
+    }
+
+    inline void putResult(std::vector<std::uint8_t> &out, const SimulationResult &result)
+    {
+        for (long long count : { result.hands, result.playerWins, result.dealerWins, result.ties,
+                                 result.playerBusts, result.dealerBusts, result.blackJacks, result.surrenders })
+            putFixed(out, static_cast<std::uint64_t>(count));
+
+        std::uint64_t units{};
+        std::memcpy(&units, &result.playerUnits, sizeof(units));
+        putFixed(out, units);
+    }
+
+    /**
+     * Returns `state` in the format described above
+     */
+    inline std::vector<std::uint8_t> encode(const RunState &state)
+    {
+        std::vector<std::uint8_t> out(std::begin(magic), std::end(magic));
+
+        auto labelSize{ std::min<std::size_t>(state.label.size(), 255) };
+        out.push_back(static_cast<std::uint8_t>(labelSize));
+        out.insert(out.end(), state.label.begin(), state.label.begin() + labelSize);
+
+        putFixed(out, state.masterSeed);
+        putFixed(out, static_cast<std::uint64_t>(state.hands));
+        putFixed(out, static_cast<std::uint64_t>(state.nextChunk));
+        putResult(out, state.finished);
+
+        putFixed(out, state.open.size(), 4);
+        for (const ChunkState &chunk : state.open)
+        {
+            putFixed(out, static_cast<std::uint64_t>(chunk.chunk));
+            putFixed(out, static_cast<std::uint64_t>(chunk.handsPlayed));
+            putResult(out, chunk.result);
+
+            out.push_back(static_cast<std::uint8_t>(chunk.deck.cardIndex));
+            for (const Card &card : chunk.deck.cards)
+                out.push_back(PackedCard{ card }.code());
+
+            const auto *engine{ reinterpret_cast<const std::uint8_t *>(&chunk.deck.engine) };
+            out.insert(out.end(), engine, engine + sizeof(chunk.deck.engine));
+        }
+
+        putFixed(out, fnv1a(out.data(), out.size()));
+        return out;
+    }
+
+
+    /**
+     * Reads fields back from an encoded checkpoint, remembering whether it
+     * ever ran past the end
+     */
+    class Reader
+    {
+    private:
+        const std::uint8_t *m_in;
+        const std::uint8_t *m_end;
+        bool m_ok{ true };
+
+    public:
+        Reader(const std::uint8_t *in, const std::uint8_t *end)
+            : m_in{ in }, m_end{ end }
+        {
+        }
+
+        bool ok() const { return m_ok; }
+
+        const std::uint8_t *take(std::size_t bytes)
+        {
+            if (not m_ok or static_cast<std::size_t>(m_end - m_in) < bytes)
+            {
+                m_ok = false;
+                return nullptr;
+            }
+            const std::uint8_t *at{ m_in };
+            m_in += bytes;
+            return at;
+        }
+
+        std::uint64_t fixed(int bytes = 8)
+        {
+            const std::uint8_t *at{ take(bytes) };
+            std::uint64_t value{ 0 };
+            for (int i{0}; at and i < bytes; i++)
+                value |= static_cast<std::uint64_t>(at[i]) << (8 * i);
+            return value;
+        }
+
+        long long signedFixed() { return static_cast<long long>(fixed()); }
+
+        SimulationResult result()
+        {
+            SimulationResult result{};
+            for (long long *count : { &result.hands, &result.playerWins, &result.dealerWins, &result.ties,
+                                      &result.playerBusts, &result.dealerBusts, &result.blackJacks, &result.surrenders })
+                *count = signedFixed();
+
+            std::uint64_t units{ fixed() };
+            std::memcpy(&result.playerUnits, &units, sizeof(units));
+            return result;
+        }
+    };
+
+    /**
+     * Decodes a checkpoint into `state`. Returns false if it is cut short,
+     * corrupt or not a checkpoint at all.
+     */
+    inline bool decode(const std::vector<std::uint8_t> &bytes, RunState &state)
+    {
+        if (bytes.size() < sizeof(magic) + 8 or std::memcmp(bytes.data(), magic, sizeof(magic)) != 0)
+            return false;
+
+        const std::uint8_t *hashAt{ bytes.data() + bytes.size() - 8 };
+        if (Reader{ hashAt, hashAt + 8 }.fixed() != fnv1a(bytes.data(), bytes.size() - 8))
+            return false;
+
+        Reader in{ bytes.data() + sizeof(magic), hashAt };
+        std::uint64_t labelSize{ in.fixed(1) };
+        const std::uint8_t *label{ in.take(labelSize) };
+        if (label)
+            state.label.assign(reinterpret_cast<const char *>(label), labelSize);
+
+        state.masterSeed = in.fixed();
+        state.hands = in.signedFixed();
+        state.nextChunk = in.signedFixed();
+        state.finished = in.result();
+
+        std::uint64_t openCount{ in.fixed(4) };
+        state.open.clear();
+        for (std::uint64_t i{0}; in.ok() and i < openCount; i++)
+        {
+            ChunkState chunk{};
+            chunk.chunk = in.signedFixed();
+            chunk.handsPlayed = in.signedFixed();
+            chunk.result = in.result();
+
+            chunk.deck.cardIndex = static_cast<int>(in.fixed(1));
+            const std::uint8_t *codes{ in.take(Global::cardsInADeck) };
+            for (int c{0}; codes and c < Global::cardsInADeck; c++)
+            {
+                if (codes[c] >= Global::cardsInADeck)
+                    return false;
+                chunk.deck.cards[c] = PackedCard{ codes[c] }.toCard();
+            }
+
+            const std::uint8_t *engine{ in.take(sizeof(chunk.deck.engine)) };
+            if (engine)
+                std::memcpy(&chunk.deck.engine, engine, sizeof(chunk.deck.engine));
+
+            if (chunk.deck.cardIndex >= Global::cardsInADeck)
+                return false;
+            state.open.push_back(chunk);
+        }
+        return in.ok();
+    }
+
+
+    /**
+     * Writes `state` to `path` through a temporary file renamed over it, so
+     * the file at `path` is always a whole checkpoint, the new one or the
+     * last one.
+     */
+    inline bool save(const std::string &path, const RunState &state)
+    {
+        std::vector<std::uint8_t> bytes{ encode(state) };
+        std::string temporary{ path + ".tmp" };
+
+        int fd{ ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) };
+        if (fd < 0)
+            return false;
+
+        std::size_t done{ 0 };
+        while (done < bytes.size())
+        {
+            ssize_t written{ ::write(fd, bytes.data() + done, bytes.size() - done) };
+            if (written <= 0)
+                break;
+            done += static_cast<std::size_t>(written);
+        }
+
+        bool ok{ done == bytes.size() and ::fsync(fd) == 0 };
+        ::close(fd);
+        return ok and std::rename(temporary.c_str(), path.c_str()) == 0;
+    }
+
+    inline bool load(const std::string &path, RunState &state)
+    {
+        std::FILE *file{ std::fopen(path.c_str(), "rb") };
+        if (not file)
+            return false;
+
+        std::vector<std::uint8_t> bytes;
+        std::uint8_t buffer[4096];
+        std::size_t read{};
+        while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+            bytes.insert(bytes.end(), buffer, buffer + read);
+        std::fclose(file);
+
+        return decode(bytes, state);
+    }
+}
+
+
+struct CheckpointOptions
+{
+    std::string path;
+    std::chrono::milliseconds interval{ 10000 };
+    int threads{ 0 };                   // 0 for one per core
+};
+
+struct CheckpointStats
+{
+    int written{ 0 };
+    int failed{ 0 };
+    std::chrono::microseconds longestPause{ 0 };
+};
+
+
+/**
+ * Plays the rest of the run `state` describes, the same way
+ * `simulateParallel()` plays a whole one, and checkpoints it to
+ * `options.path` every `options.interval`.
+ *
+ * Workers play their chunk `checkpoint::handsPerSlice` hands at a time.
+ * To take a checkpoint, a background thread asks every worker to stop at
+ * the end of its slice, copies their chunks and totals while no chunk can
+ * be claimed, then lets them go before encoding and writing the file. The
+ * workers only wait for the slowest of them to finish a slice.
+ *
+ * Every total is a whole count or a multiple of half a unit, so the result
+ * is bit for bit the same however often the run was stopped and resumed,
+ * and on however many threads.
+ *
+ * @param strategy the player's hit/stay policy, copied into every chunk
+ * @param state the run so far, e.g. from `checkpoint::load()`; on return it
+ *      holds the finished run
+ * @param options where and how often to checkpoint, and on how many threads
+ * @param stats counts the checkpoints written and the longest pause
+ */
+template <typename Strategy>
+SimulationResult simulateCheckpointed(Strategy strategy, checkpoint::RunState &state,
+                                      const CheckpointOptions &options, CheckpointStats &stats)
+{
+    using checkpoint::ChunkState;
+
+    int threads{ options.threads > 0 ? options.threads
+                                     : static_cast<int>(std::max(1u, std::thread::hardware_concurrency())) };
+    long long chunks{ (state.hands + handsPerChunk - 1) / handsPerChunk };
+
+    // Chunks the checkpoint had open are played before any new one
+    std::deque<ChunkState> resumed(state.open.begin(), state.open.end());
+    std::atomic<long long> nextChunk{ state.nextChunk };
+
+    // One slot per worker, read by the checkpoint thread while it is paused
+    struct alignas(64) WorkerSlot
+    {
+        SimulationResult finished{};
+        bool holding{ false };
+        ChunkState current{};
+    };
+    std::vector<WorkerSlot> slots(threads);
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::atomic<bool> pauseRequested{ false };
+    int paused{ 0 };
+    int active{ threads };
+    long long generation{ 0 };
+
+    // Takes the next resumed chunk, or failing that a fresh one
+    auto claim = [&](ChunkState &chunk, Deck &deck)
+    {
+        {
+            std::lock_guard<std::mutex> lock{ mutex };
+            if (not resumed.empty())
+            {
+                chunk = resumed.front();
+                resumed.pop_front();
+                deck.restore(chunk.deck);
+                return true;
+            }
+        }
+
+        long long fresh{ nextChunk.fetch_add(1, std::memory_order_relaxed) };
+        if (fresh >= chunks)
+            return false;
+
+        chunk = ChunkState{};
+        chunk.chunk = fresh;
+        deck = Deck{ chunkSeed(state.masterSeed, fresh) };
+        deck.shuffle();
+        return true;
+    };
+
+    std::vector<std::thread> workers;
+    for (int w{0}; w < threads; w++)
+    {
+        workers.emplace_back([&, w]()
+        {
+            SimulationResult finished{};
+            ChunkState chunk{};
+            Deck deck{ std::uint64_t{ 0 } };
+
+            while (claim(chunk, deck))
+            {
+                long long count{ std::min(handsPerChunk, state.hands - chunk.chunk * handsPerChunk) };
+                while (chunk.handsPlayed < count)
+                {
+                    long long slice{ std::min(checkpoint::handsPerSlice, count - chunk.handsPlayed) };
+                    chunk.result += simulate(deck, strategy, slice);
+                    chunk.handsPlayed += slice;
+
+                    if (not pauseRequested.load(std::memory_order_acquire))
+                        continue;
+
+                    std::unique_lock<std::mutex> lock{ mutex };
+                    if (not pauseRequested.load(std::memory_order_relaxed))
+                        continue;
+
+                    chunk.deck = deck.state();
+                    slots[w].finished = finished;
+                    slots[w].current = chunk;
+                    slots[w].holding = true;
+                    ++paused;
+                    changed.notify_all();
+
+                    long long seen{ generation };
+                    changed.wait(lock, [&]() { return generation != seen; });
+                }
+                finished += chunk.result;
+            }
+
+            std::lock_guard<std::mutex> lock{ mutex };
+            slots[w].finished = finished;
+            slots[w].holding = false;
+            --active;
+            changed.notify_all();
+        });
+    }
+
+    // The state of the run with every worker stopped. Needs `mutex` held.
+    auto cut = [&]()
+    {
+        checkpoint::RunState now{};
+        now.label = state.label;
+        now.masterSeed = state.masterSeed;
+        now.hands = state.hands;
+        now.nextChunk = std::min(nextChunk.load(std::memory_order_relaxed), chunks);
+        now.finished = state.finished;
+        for (const WorkerSlot &slot : slots)
+        {
+            now.finished += slot.finished;
+            if (slot.holding)
+                now.open.push_back(slot.current);
+        }
+        now.open.insert(now.open.end(), resumed.begin(), resumed.end());
+        return now;
+    };
+
+    std::thread checkpointer{ [&]()
+    {
+        std::unique_lock<std::mutex> lock{ mutex };
+        while (not changed.wait_for(lock, options.interval, [&]() { return active == 0; }))
+        {
+            auto start{ std::chrono::steady_clock::now() };
+            pauseRequested.store(true, std::memory_order_release);
+            changed.wait(lock, [&]() { return paused == active; });
+
+            checkpoint::RunState now{ cut() };
+
+            pauseRequested.store(false, std::memory_order_relaxed);
+            paused = 0;
+            for (WorkerSlot &slot : slots)
+                slot.holding = false;
+            ++generation;
+            changed.notify_all();
+
+            stats.longestPause = std::max(stats.longestPause,
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+
+            // The file is written with the workers running again
+            lock.unlock();
+            bool saved{ checkpoint::save(options.path, now) };
+            lock.lock();
+            ++(saved ? stats.written : stats.failed);
+        }
+    } };
+
+    for (auto &worker : workers)
+        worker.join();
+    checkpointer.join();
+
+    // The finished run, so that resuming it again plays nothing
+    state = cut();
+    ++(checkpoint::save(options.path, state) ? stats.written : stats.failed);
+
+    return state.finished;
+}
+
+#endif /* checkpoint_hpp */
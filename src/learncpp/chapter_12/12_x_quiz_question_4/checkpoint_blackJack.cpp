@@ -0,0 +1,95 @@
+//
+//  checkpoint_blackJack.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "player.cpp"
+#include "simulation.hpp"
+#include "parallel_simulation.hpp"
+#include "strategy_names.hpp"
+#include "checkpoint.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+
+/**
+ * Plays the rest of `state` with the strategy its label names, which must
+ * be a valid strategy name, then prints the totals and how the checkpoints
+ * went.
+ */
+int playRun(checkpoint::RunState &state, const CheckpointOptions &options)
+{
+    std::cout << "[INFO] - Run of " << state.hands << " hands, strategy " << state.label
+              << ", master seed " << state.masterSeed << ", " << state.handsPlayed() << " played so far\n";
+
+    CheckpointStats stats{};
+    auto start{ std::chrono::steady_clock::now() };
+    SimulationResult result{};
+    withStrategy(state.label, [&](auto strategy) { result = simulateCheckpointed(strategy, state, options, stats); });
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "[INFO] - Checkpoints written = " << stats.written << ", longest pause = "
+              << stats.longestPause.count() << " us, " << elapsed.count() << " s\n";
+    if (stats.failed)
+        std::cout << "[ERROR] - " << stats.failed << " checkpoints could not be written to " << options.path << "\n";
+
+    std::cout << "[INFO] - Hands = " << result.hands
+              << ", player wins = " << result.playerWins
+              << ", dealer wins = " << result.dealerWins
+              << ", ties = " << result.ties << "\n";
+    std::cout << "[INFO] - Player busts = " << result.playerBusts
+              << ", dealer busts = " << result.dealerBusts
+              << ", player units = " << std::fixed << std::setprecision(1) << result.playerUnits << "\n";
+    return stats.failed ? 1 : 0;
+}
+
+// Usage: checkpoint_blackJack run <file> [hands] [hit below | basic] [seed] [threads] [interval ms]
+//        checkpoint_blackJack resume <file> [threads] [interval ms]
+int main(int argc, char *argv[])
+{
+    if (argc < 3 or (std::strcmp(argv[1], "run") != 0 and std::strcmp(argv[1], "resume") != 0))
+    {
+        std::cout << "[ERROR] - Usage: checkpoint_blackJack run <file> [hands] [hit below | basic] [seed] [threads] [interval ms]\n"
+                  << "                 checkpoint_blackJack resume <file> [threads] [interval ms]\n";
+        return 1;
+    }
+
+    CheckpointOptions options{};
+    options.path = argv[2];
+    checkpoint::RunState state{};
+
+    int next{ 3 };
+    if (std::strcmp(argv[1], "run") == 0)
+    {
+        state.hands = argc > 3 ? std::atoll(argv[3]) : 1000000000;
+        state.label = argc > 4 ? argv[4] : "basic";
+        state.masterSeed = argc > 5 ? std::strtoull(argv[5], nullptr, 10) : seedFromDevice();
+        next = 6;
+    }
+    else if (not checkpoint::load(options.path, state))
+    {
+        std::cout << "[ERROR] - " << options.path << " is not a readable checkpoint\n";
+        return 1;
+    }
+
+    if (not isStrategyName(state.label))
+    {
+        std::cout << "[ERROR] - Unknown strategy " << state.label << ", use `basic` or a number to hit below\n";
+        return 1;
+    }
+
+    options.threads = argc > next ? std::atoi(argv[next]) : 0;
+    options.interval = std::chrono::milliseconds{ argc > next + 1 ? std::atol(argv[next + 1]) : 10000 };
+
+    return playRun(state, options);
+}
@@ -0,0 +1,100 @@
+//
+//  compare_blackJack.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "shoe.cpp"
+#include "player.cpp"
+#include "simulation.hpp"
+#include "strategy_comparison.hpp"
+#include "strategy_names.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+/**
+ * Prints what a comparison found and how many hands it saved.
+ */
+void printComparison(const ComparisonResult &result, const ComparisonOptions &options, double seconds)
+{
+    const RunningStats &difference{ result.difference };
+    long long hands{ result.first.count() };
+    double independent{ result.independentHands(difference.halfWidth(options.z), options.z) };
+
+    std::cout << "[INFO] - First EV / hand    = " << result.first.mean() << "\n";
+    std::cout << "[INFO] - Second EV / hand   = " << result.second.mean() << "\n";
+    std::cout << "[INFO] - EV difference      = " << difference.mean()
+              << " +/- " << difference.halfWidth(options.z) << "\n";
+    std::cout << "[INFO] - Trials             = " << result.trials()
+              << (result.converged ? "" : " (stopped at the limit)") << "\n";
+    std::cout << "[INFO] - Hands per strategy = " << hands << "\n";
+    std::cout << "[INFO] - Independent runs   = " << static_cast<long long>(independent)
+              << " hands per strategy for the same interval (x" << independent / hands << ")\n";
+    std::cout << "[INFO] - Hands / second     = " << static_cast<long long>(2 * hands / seconds) << "\n";
+}
+
+// Usage: compare_blackJack <first> <second> [half width] [seed] [decks] [--antithetic]
+//        where a strategy is `basic` or a number to hit below
+int main(int argc, char *argv[])
+{
+    ComparisonOptions options{};
+    std::vector<std::string> args;
+    for (int i{1}; i < argc; i++)
+    {
+        std::string arg{ argv[i] };
+        if (arg == "--antithetic")
+            options.antithetic = true;
+        else
+            args.push_back(arg);
+    }
+
+    if (args.size() < 2)
+    {
+        std::cout << "[ERROR] - Usage: compare_blackJack <first> <second> [half width] [seed] [decks] [--antithetic]\n";
+        return 1;
+    }
+    if (args.size() > 2)
+        options.targetHalfWidth = std::atof(args[2].c_str());
+    std::uint64_t seed{ args.size() > 3 ? std::strtoull(args[3].c_str(), nullptr, 10) : seedFromDevice() };
+    int decks{ args.size() > 4 ? std::atoi(args[4].c_str()) : 1 };
+
+    ComparisonResult result{};
+    auto start{ std::chrono::steady_clock::now() };
+
+    bool known{ withStrategy(args[0], [&](auto first)
+    {
+        withStrategy(args[1], [&](auto second)
+        {
+            if (decks > 1)
+            {
+                Shoe shoe{ decks, 0, seed };
+                result = compareStrategies(shoe, first, second, options);
+            }
+            else
+            {
+                Deck deck{ seed };
+                result = compareStrategies(deck, first, second, options);
+            }
+        });
+    }) };
+
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    if (not known or result.trials() == 0)
+    {
+        std::cout << "[ERROR] - A strategy is `basic` or a number to hit below\n";
+        return 1;
+    }
+
+    printComparison(result, options, elapsed.count());
+    return 0;
+}
@@ -0,0 +1,58 @@
+//
+//  composition_ev.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "shoe.cpp"
+#include "player.cpp"
+#include "simulation.hpp"
+#include "ev_cache.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+
+/**
+ * Prints the EV cache counters, to size the cache for long runs.
+ */
+void printCacheStats(const EvCacheStats &stats)
+{
+    std::cout << "[INFO] - EV cache size      = " << stats.size << " / " << stats.capacity << "\n";
+    std::cout << "[INFO] - EV cache hits      = " << stats.hits << "\n";
+    std::cout << "[INFO] - EV cache misses    = " << stats.misses << "\n";
+    std::cout << "[INFO] - EV cache evictions = " << stats.evictions << "\n";
+    std::cout << "[INFO] - EV cache hit rate  = " << 100.0 * stats.hitRate() << "%\n";
+}
+
+// Usage: composition_ev [hands] [decks] [cache capacity]
+int main(int argc, char *argv[])
+{
+    long long hands{ argc > 1 ? std::atoll(argv[1]) : 20000 };
+    int decks{ argc > 2 ? std::atoi(argv[2]) : 6 };
+    std::size_t capacity{ argc > 3 ? std::strtoull(argv[3], nullptr, 10) : std::size_t{ 1 } << 18 };
+    if (decks < 1 or decks > ShoeComposition::maxDecks)
+    {
+        std::cout << "[ERROR] - Usage: composition_ev [hands] [decks, 1 to " << ShoeComposition::maxDecks
+                  << "] [cache capacity]\n";
+        return 1;
+    }
+
+    Shoe shoe{ decks };
+    CompositionEvaluator evaluator{ StrategyRules{}, capacity };
+
+    auto start{ std::chrono::steady_clock::now() };
+    SimulationResult result{ simulate(shoe, CompositionStrategy<Shoe>{ shoe, evaluator }, hands) };
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "[INFO] - Hands played       = " << result.hands << "\n";
+    std::cout << "[INFO] - Player EV          = "
+              << static_cast<double>(result.playerWins - result.dealerWins) / result.hands << "\n";
+    std::cout << "[INFO] - Hands / second     = " << static_cast<long long>(result.hands / elapsed.count()) << "\n";
+    printCacheStats(evaluator.cacheStats());
+    return 0;
+}
@@ -0,0 +1,64 @@
+//
+//  dealer_odds.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "dealer_probabilities.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+
+/**
+ * Prints the dealer's outcome probabilities for each upcard.
+ */
+void printDealerOdds(const std::array<DealerOutcome, cardClasses> &outcomes, int dealerStandsOn)
+{
+    std::cout << "upcard";
+    for (int t{ dealerStandsOn }; t <= Global::blackJack; t++)
+        std::cout << std::setw(9) << t;
+    std::cout << std::setw(9) << "BJ" << std::setw(9) << "bust" << "\n";
+
+    std::cout << std::fixed << std::setprecision(5);
+    for (int c{0}; c < cardClasses; c++)
+    {
+        std::cout << std::setw(6) << (c == aceClass ? "A" : std::to_string(c + 2));
+        for (int t{ dealerStandsOn }; t <= Global::blackJack; t++)
+            std::cout << std::setw(9) << outcomes[c].total(t);
+        std::cout << std::setw(9) << outcomes[c].blackJack()
+                  << std::setw(9) << outcomes[c].bust() << "\n";
+    }
+}
+
+// Usage: dealer_odds [decks] [dealer hits soft 17 (0/1)]
+int main(int argc, char *argv[])
+{
+    int decks{ argc > 1 ? std::atoi(argv[1]) : 6 };
+    if (decks < 1 or decks > ShoeComposition::maxDecks)
+    {
+        std::cout << "[ERROR] - Usage: dealer_odds [decks, 1 to " << ShoeComposition::maxDecks
+                  << "] [dealer hits soft 17 (0/1)]\n";
+        return 1;
+    }
+
+    StrategyRules rules{};
+    if (argc > 2)
+        rules.dealerHitsSoft17 = std::atoi(argv[2]) != 0;
+
+    auto start{ std::chrono::steady_clock::now() };
+    DealerProbabilities dealer{ rules };
+    auto outcomes{ dealer.outcomeByUpcard(ShoeComposition::fullShoe(decks)) };
+    std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "[INFO] - Dealer outcomes from a fresh " << decks << " deck shoe\n\n";
+    printDealerOdds(outcomes, rules.dealerStandsOn);
+    std::cout << "\n[INFO] - " << dealer.memoSize() << " memoized states, "
+              << elapsed.count() << " ms\n";
+    return 0;
+}
@@ -0,0 +1,145 @@
+//
+//  dealer_probabilities.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef dealer_probabilities_hpp
+#define dealer_probabilities_hpp
+
+#include "globals.cpp"
+#include "basic_strategy.hpp"
+#include "shoe_composition.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+
+/**
+ * Probabilities of how the dealer's hand ends.
+ */
+struct DealerOutcome
+{
+    static constexpr int blackJackIndex{ Global::blackJack + 1 };
+    static constexpr int bustIndex{ Global::blackJack + 2 };
+
+    // Index t <= 21: finished on t (other than a two card 21),
+    // then two card 21 and bust
+    std::array<double, Global::blackJack + 3> p{};
+
+    double total(int t) const { return p[t]; }
+    double blackJack() const { return p[blackJackIndex]; }
+    double bust() const { return p[bustIndex]; }
+
+    DealerOutcome &operator+=(const DealerOutcome &other)
+    {
+        for (std::size_t i{0}; i < p.size(); i++)
+            p[i] += other.p[i];
+        return *this;
+    }
+};
+
+
+/**
+ * Exact dealer outcome probabilities for a given remaining shoe.
+ *
+ * The dealer's play is fixed (hit below `dealerStandsOn`, optionally hitting
+ * soft 17), so the outcome only depends on the dealer's hand and the cards
+ * left. Every draw is enumerated without replacement and the result of
+ * each (composition, dealer hand) state is memoized, so states reached by
+ * drawing the same cards in a different order, or shared between upcards and
+ * later calls, are only solved once.
+ */
+class DealerProbabilities
+{
+private:
+    StrategyRules m_rules{};
+    std::unordered_map<CompositionKey, DealerOutcome, CompositionKeyHash> m_memo;
+
+    static std::uint16_t packHand(int score, bool isSoft, bool hasOneCard)
+    {
+        return static_cast<std::uint16_t>((score << 2) | (isSoft << 1) | hasOneCard);
+    }
+
+    DealerOutcome solve(int score, bool isSoft, bool hasOneCard, const ShoeComposition &shoe)
+    {
+        CompositionKey key{ shoe.code(), packHand(score, isSoft, hasOneCard) };
+        auto found{ m_memo.find(key) };
+        if (found != m_memo.end())
+            return found->second;
+
+        DealerOutcome outcome{};
+        for (int c{0}; c < cardClasses; c++)
+        {
+            if (shoe.count(c) == 0)
+                continue;
+
+            double p{ shoe.probability(c) };
+            int nextScore{ score };
+            bool nextSoft{ isSoft };
+            addCardValue(nextScore, nextSoft, c + 2);
+
+            if (nextScore > Global::blackJack)
+                outcome.p[DealerOutcome::bustIndex] += p;
+            else if (hasOneCard and nextScore == Global::blackJack)
+                outcome.p[DealerOutcome::blackJackIndex] += p;
+            else if (m_rules.dealerStands(nextScore, nextSoft))
+                outcome.p[nextScore] += p;
+            else
+            {
+                DealerOutcome next{ solve(nextScore, nextSoft, false, shoe.without(c)) };
+                for (std::size_t i{0}; i < outcome.p.size(); i++)
+                    outcome.p[i] += p * next.p[i];
+            }
+        }
+
+        m_memo.emplace(key, outcome);
+        return outcome;
+    }
+
+public:
+    explicit DealerProbabilities(const StrategyRules &rules = {})
+        : m_rules{ rules }
+    {
+    }
+
+    /**
+     * Returns the dealer's outcome probabilities once `dealerUpcard` (2 to
+     * 11) is showing and `remaining` holds the cards left, upcard excluded.
+     */
+    DealerOutcome outcome(int dealerUpcard, const ShoeComposition &remaining)
+    {
+        return solve(dealerUpcard, dealerUpcard == 11, true, remaining);
+    }
+
+    /**
+     * Returns the outcome for every upcard dealt from `shoe`, indexed by card
+     * class. The upcard is taken out of the shoe before the dealer draws.
+     */
+    std::array<DealerOutcome, cardClasses> outcomeByUpcard(const ShoeComposition &shoe)
+    {
+        std::array<DealerOutcome, cardClasses> outcomes{};
+        for (int c{0}; c < cardClasses; c++)
+        {
+            if (shoe.count(c) > 0)
+                outcomes[c] = outcome(c + 2, shoe.without(c));
+        }
+        return outcomes;
+    }
+
+    std::size_t memoSize() const
+    {
+        return m_memo.size();
+    }
+
+    void clear()
+    {
+        m_memo.clear();
+    }
+};
+
+#endif /* dealer_probabilities_hpp */
@@ -9,51 +9,133 @@
 
 #include "deck.hpp"
 #include "card.hpp"
+#include "instrumentation.hpp"
 
+#include <algorithm>
+#include <cassert>
 #include <iostream>
-#include <random>
 
 
-Deck::Deck()
+template <typename Engine>
+BasicDeck<Engine>::BasicDeck()
+    : BasicDeck(seedFromDevice())
 {
-    for(int s{0}; s < static_cast<int>(Card::Suit::max_suits); s++)
-    {
-        for(int r{0}; r < static_cast<int>(Card::Rank::max_rank); r++)
-        {
-            m_deck[(s*Global::cardInASuit) + r] = {static_cast<Card::Rank>(r), static_cast<Card::Suit>(s)};
-        }
-    }
 }
 
-void Deck::print()
+/**
+ * Builds an ordered deck whose shuffles are driven by an engine seeded with
+ * `seed`, so the same seed always deals the same cards.
+ */
+template <typename Engine>
+BasicDeck<Engine>::BasicDeck(std::uint64_t seed)
+    : BasicDeck(Engine(seed))
 {
-    for(int i{0}; i < Global::cardsInADeck; i++)
-    {
-        m_deck[i].print(); std::cout << "\t";
-    }
-    std::cout << "\n\n";
 }
 
-void Deck::shuffle()
+template <typename Engine>
+BasicDeck<Engine>::BasicDeck(const Engine &engine)
+    : m_engine{ engine }
+{
+    std::copy(cards::orderedDeck.begin(), cards::orderedDeck.end(), m_deck);
+}
+
+template <typename Engine>
+void BasicDeck<Engine>::print()
 {
-    std::random_device rd;
-    std::mt19937 g(rd());
-    std::shuffle(m_deck, m_deck + Global::cardsInADeck, g);
+    char text[formattedSize];
+    std::cout.write(text, format(text) - text);
 }
 
-const Card &Deck::dealCard()
+/**
+ * Writes the deck in its current order at `out`, the same text `print()`
+ * shows, and returns the position after it. `out` needs room for
+ * `formattedSize` characters.
+ */
+template <typename Engine>
+char *BasicDeck<Engine>::format(char *out) const
+{
+    out = formatCards(out, m_deck, m_deck + Global::cardsInADeck);
+    *out++ = '\n';
+    *out++ = '\n';
+    return out;
+}
+
+template <typename Engine>
+void BasicDeck<Engine>::shuffle()
+{
+    INSTRUMENT_TIME_SAMPLED(shuffle_latency, shuffles, instrument::shuffleSampleEvery);
+    INSTRUMENT_COUNT(shuffles, 1);
+    shuffleCards(m_deck, Global::cardsInADeck, m_engine);
+}
+
+template <typename Engine>
+const Card &BasicDeck<Engine>::dealCard()
 {
     int cardIndex{ m_cardIndex };
     
     if (++cardIndex >= Global::cardsInADeck)
     {
         m_cardIndex = 0;
-        Deck::shuffle();
+        INSTRUMENT_COUNT(reshuffles, 1);
+        shuffle();
     }
+    INSTRUMENT_COUNT(cards_dealt, 1);
     return m_deck[ m_cardIndex++ ];
 }
 
-int Deck::getIndex()
+/**
+ * Deals the next `count` cards at once, the same cards `count` calls to
+ * `dealCard()` would give.
+ *
+ * When no reshuffle falls inside the batch the cards are handed out in
+ * place, with one index check for the whole batch. Otherwise they are dealt
+ * one by one into a staging buffer, which the span then points to.
+ */
+template <typename Engine>
+CardSpan BasicDeck<Engine>::deal(int count)
+{
+    assert(count >= 0 && count <= maxDeal && "batch larger than a deck");
+    
+    // `dealCard()` reshuffles before dealing the last card of the deck
+    if (m_cardIndex + count < Global::cardsInADeck)
+    {
+        const Card *first{ m_deck + m_cardIndex };
+        m_cardIndex += count;
+        INSTRUMENT_COUNT(cards_dealt, count);
+        return { first, first + count };
+    }
+    
+    for (int i{0}; i < count; i++)
+        m_staging[i] = dealCard();
+    return { m_staging, m_staging + count };
+}
+
+template <typename Engine>
+int BasicDeck<Engine>::getIndex()
 {
     return m_cardIndex;
 }
+
+/**
+ * Returns the deck's order, position and engine, so that a deck given the
+ * same state with `restore()` deals the same cards from then on.
+ */
+template <typename Engine>
+typename BasicDeck<Engine>::State BasicDeck<Engine>::state() const
+{
+    State state{};
+    state.cardIndex = m_cardIndex;
+    std::copy(m_deck, m_deck + Global::cardsInADeck, state.cards);
+    state.engine = m_engine;
+    return state;
+}
+
+template <typename Engine>
+void BasicDeck<Engine>::restore(const State &state)
+{
+    assert(state.cardIndex >= 0 && state.cardIndex <= Global::cardsInADeck && "card index out of the deck");
+    
+    m_cardIndex = state.cardIndex;
+    std::copy(state.cards, state.cards + Global::cardsInADeck, m_deck);
+    m_engine = state.engine;
+}
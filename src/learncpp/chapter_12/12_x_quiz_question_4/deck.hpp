@@ -11,22 +11,59 @@
 
 #include "globals.cpp"
 #include "card.hpp"
+#include "random_engines.hpp"
 
+#include <cstddef>
+#include <cstdint>
 
-class Deck
+
+/**
+ * A single deck of cards, shuffled by an engine of type `Engine` that lives
+ * as long as the deck. Any UniformRandomBitGenerator can be used.
+ */
+template <typename Engine>
+class BasicDeck
 {
 private:
     int m_cardIndex{ 0 };
     Card m_deck[ Global::cardsInADeck ];
+    Card m_staging[ Global::cardsInADeck ];
+    Engine m_engine;
     
 public:
-    Deck();
+    // Most cards a single `deal()` hands out
+    static constexpr int maxDeal{ Global::cardsInADeck };
+    
+    // Characters `format()` writes: every card and a tab, then a blank line
+    static constexpr std::size_t formattedSize{ Global::cardsInADeck * (Card::textSize + 1) + 2 };
+    
+    BasicDeck();
+    explicit BasicDeck(std::uint64_t seed);
+    explicit BasicDeck(const Engine &engine);
     void print();
+    char *format(char *out) const;
     void shuffle();
     const Card &dealCard();
+    CardSpan deal(int count);
     int getIndex();
 
+    // The cards in their current order, e.g. for `LockstepHands`
+    const Card *cards() const { return m_deck; }
+
+    // Everything the deck needs to carry on dealing exactly where it is
+    struct State
+    {
+        int cardIndex{ 0 };
+        Card cards[ Global::cardsInADeck ];
+        Engine engine{};
+    };
+
+    State state() const;
+    void restore(const State &state);
+
 };
 
+using Deck = BasicDeck<Pcg32>;
+
 
 #endif /* deck_hpp */
@@ -0,0 +1,271 @@
+//
+//  ev_cache.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef ev_cache_hpp
+#define ev_cache_hpp
+
+#include "globals.cpp"
+#include "basic_strategy.hpp"
+#include "shoe_composition.hpp"
+#include "dealer_probabilities.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+
+/**
+ * Expected values of standing and hitting in one situation.
+ */
+struct HandEv
+{
+    double stand{ 0.0 };
+    double hit{ 0.0 };
+
+    double best() const { return std::max(stand, hit); }
+};
+
+
+struct EvCacheStats
+{
+    long long hits{ 0 };
+    long long misses{ 0 };
+    long long evictions{ 0 };
+    std::size_t size{ 0 };
+    std::size_t capacity{ 0 };
+
+    double hitRate() const
+    {
+        long long lookups{ hits + misses };
+        return lookups ? static_cast<double>(hits) / lookups : 0.0;
+    }
+};
+
+
+/**
+ * Bounded cache of stand/hit EVs keyed on the remaining shoe composition and
+ * the (player score, soft, dealer upcard) situation.
+ *
+ * Holds at most `capacity` entries and evicts the least recently used one
+ * when full, so memory stays fixed however long a run goes on.
+ */
+class EvCache
+{
+private:
+    using Entry = std::pair<CompositionKey, HandEv>;
+
+    std::size_t m_capacity{ 0 };
+    std::list<Entry> m_entries;     // most recently used first
+    std::unordered_map<CompositionKey, std::list<Entry>::iterator, CompositionKeyHash> m_index;
+    EvCacheStats m_stats{};
+
+public:
+    explicit EvCache(std::size_t capacity = 1 << 20)
+        : m_capacity{ std::max<std::size_t>(capacity, 1) }
+    {
+        m_index.reserve(m_capacity);
+    }
+
+    static CompositionKey makeKey(const ShoeComposition &shoe, int playerScore, bool isSoft, int dealerUpcard)
+    {
+        return { shoe.code(), static_cast<std::uint16_t>((playerScore << 5) | (dealerUpcard << 1) | isSoft) };
+    }
+
+    /**
+     * Returns the cached EVs for `key`, or nullptr on a miss
+     */
+    const HandEv *find(const CompositionKey &key)
+    {
+        auto found{ m_index.find(key) };
+        if (found == m_index.end())
+        {
+            ++m_stats.misses;
+            return nullptr;
+        }
+
+        ++m_stats.hits;
+        m_entries.splice(m_entries.begin(), m_entries, found->second);
+        return &found->second->second;
+    }
+
+    void insert(const CompositionKey &key, const HandEv &ev)
+    {
+        auto found{ m_index.find(key) };
+        if (found != m_index.end())
+        {
+            found->second->second = ev;
+            m_entries.splice(m_entries.begin(), m_entries, found->second);
+            return;
+        }
+
+        if (m_entries.size() >= m_capacity)
+        {
+            m_index.erase(m_entries.back().first);
+            m_entries.pop_back();
+            ++m_stats.evictions;
+        }
+
+        m_entries.emplace_front(key, ev);
+        m_index.emplace(key, m_entries.begin());
+    }
+
+    EvCacheStats stats() const
+    {
+        EvCacheStats stats{ m_stats };
+        stats.size = m_entries.size();
+        stats.capacity = m_capacity;
+        return stats;
+    }
+
+    void clear()
+    {
+        m_entries.clear();
+        m_index.clear();
+    }
+};
+
+
+/**
+ * Composition dependent stand/hit EVs: computed for the cards actually left
+ * in the shoe instead of full-deck weights.
+ *
+ * Standing is scored against the exact dealer outcome for the composition.
+ * Hitting follows the usual composition dependent approximation: the
+ * player's later draws use the composition at the decision point, which
+ * keeps one dealer solve per decision instead of one per possible hit card.
+ * Results go through the EV cache, and the dealer memo is dropped whenever it
+ * outgrows `dealerMemoLimit`, so both caches stay bounded.
+ */
+class CompositionEvaluator
+{
+private:
+    DealerProbabilities m_dealer;
+    EvCache m_cache;
+    std::size_t m_dealerMemoLimit{ 0 };
+
+    // Per decision scratch state: the dealer outcome and the player's best
+    // EV of every (score, soft) state for the composition being evaluated
+    DealerOutcome m_outcome{};
+    CardWeights m_weights{};
+    std::array<std::array<double, 2>, Global::blackJack + 1> m_best{};
+    std::array<std::array<bool, 2>, Global::blackJack + 1> m_bestDone{};
+
+    double standEv(int playerScore) const
+    {
+        // This game has no blackjack bonus, a two card 21 is simply 21
+        double ev{ m_outcome.bust() };
+        for (int t{0}; t <= DealerOutcome::blackJackIndex; t++)
+        {
+            int total{ t == DealerOutcome::blackJackIndex ? Global::blackJack : t };
+            if (total < playerScore)
+                ev += m_outcome.p[t];
+            else if (total > playerScore)
+                ev -= m_outcome.p[t];
+        }
+        return ev;
+    }
+
+    double hitEv(int playerScore, bool isSoft)
+    {
+        double ev{ 0.0 };
+        for (int c{0}; c < cardClasses; c++)
+        {
+            int nextScore{ playerScore };
+            bool nextSoft{ isSoft };
+            addCardValue(nextScore, nextSoft, c + 2);
+            ev += m_weights[c] * bestEv(nextScore, nextSoft);
+        }
+        return ev;
+    }
+
+    double bestEv(int playerScore, bool isSoft)
+    {
+        if (playerScore > Global::blackJack)
+            return -1.0;
+        if (not m_bestDone[playerScore][isSoft])
+        {
+            m_best[playerScore][isSoft] = (playerScore == Global::blackJack)
+                ? standEv(playerScore)
+                : std::max(standEv(playerScore), hitEv(playerScore, isSoft));
+            m_bestDone[playerScore][isSoft] = true;
+        }
+        return m_best[playerScore][isSoft];
+    }
+
+public:
+    explicit CompositionEvaluator(const StrategyRules &rules = {},
+                                  std::size_t cacheCapacity = 1 << 20,
+                                  std::size_t dealerMemoLimit = 1 << 20)
+        : m_dealer{ rules }, m_cache{ cacheCapacity }, m_dealerMemoLimit{ dealerMemoLimit }
+    {
+    }
+
+    /**
+     * Returns the stand and hit EVs of a player on `playerScore` against
+     * `dealerUpcard` with the cards in `shoe` left to draw.
+     */
+    HandEv evaluate(int playerScore, bool isSoft, int dealerUpcard, const ShoeComposition &shoe)
+    {
+        CompositionKey key{ EvCache::makeKey(shoe, playerScore, isSoft, dealerUpcard) };
+        if (const HandEv *cached{ m_cache.find(key) })
+            return *cached;
+
+        if (m_dealer.memoSize() > m_dealerMemoLimit)
+            m_dealer.clear();
+
+        m_outcome = m_dealer.outcome(dealerUpcard, shoe);
+        m_weights = shoe.weights();
+        for (auto &row : m_bestDone)
+            row.fill(false);
+
+        HandEv ev{ standEv(playerScore), hitEv(playerScore, isSoft) };
+        m_cache.insert(key, ev);
+        return ev;
+    }
+
+    EvCacheStats cacheStats() const
+    {
+        return m_cache.stats();
+    }
+
+    std::size_t dealerMemoSize() const
+    {
+        return m_dealer.memoSize();
+    }
+};
+
+
+/**
+ * Decision policy that hits whenever hitting has the higher EV for the
+ * cards still left in `shoe`.
+ */
+template <typename ShoeType>
+class CompositionStrategy
+{
+private:
+    const ShoeType *m_shoe{ nullptr };
+    CompositionEvaluator *m_evaluator{ nullptr };
+
+public:
+    CompositionStrategy(const ShoeType &shoe, CompositionEvaluator &evaluator)
+        : m_shoe{ &shoe }, m_evaluator{ &evaluator }
+    {
+    }
+
+    bool operator()(int playerScore, bool isSoft, int dealerUpcard) const
+    {
+        ShoeComposition left{ ShoeComposition::fromCards(m_shoe->undealtBegin(), m_shoe->undealtEnd()) };
+        HandEv ev{ m_evaluator->evaluate(playerScore, isSoft, dealerUpcard, left) };
+        return ev.hit > ev.stand;
+    }
+};
+
+#endif /* ev_cache_hpp */
@@ -0,0 +1,120 @@
+//
+//  generate_strategy.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "basic_strategy.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+
+/**
+ * Prints the table as a grid of H(it) / S(tand) per total and upcard, R
+ * marking a surrender where the rules allow one.
+ */
+void printStrategyTable(const StrategyTable &table)
+{
+    std::cout << "        ";
+    for (int up{2}; up <= 11; up++)
+        std::cout << std::setw(3) << (up == 11 ? "A" : std::to_string(up));
+    std::cout << "\n";
+
+    for (int soft{0}; soft < 2; soft++)
+    {
+        for (int score{ soft ? 11 : 2 }; score < Global::blackJack; score++)
+        {
+            std::cout << (soft ? "soft " : "hard ") << std::setw(2) << score << " ";
+            for (int up{2}; up <= 11; up++)
+            {
+                char decision{ table.shouldHit(score, soft, up) ? 'H' : 'S' };
+                if (table.shouldSurrender(score, soft, up))
+                    decision = 'R';
+                std::cout << std::setw(3) << decision;
+            }
+            std::cout << "\n";
+        }
+    }
+}
+
+/**
+ * Writes one row of the table as a brace enclosed list of hex masks.
+ */
+void writeRow(std::ostream &out, const std::array<std::uint16_t, Global::blackJack + 1> &row)
+{
+    out << "{{";
+    for (std::size_t i{0}; i < row.size(); i++)
+    {
+        out << (i ? ", " : " ") << "0x" << std::hex << std::setw(4) << std::setfill('0')
+            << row[i] << std::dec << std::setfill(' ');
+    }
+    out << " }}";
+}
+
+/**
+ * Writes the table as a header holding a constexpr `basicStrategyTable`.
+ */
+void writeStrategyHeader(std::ostream &out, const StrategyTable &table, const StrategyRules &rules)
+{
+    out << "//\n"
+           "//  basic_strategy_table.hpp\n"
+           "//  learncpp\n"
+           "//\n"
+           "//  Generated by generate_strategy.cpp, do not edit by hand.\n"
+           "//  Dealer stands on " << rules.dealerStandsOn
+        << (rules.dealerHitsSoft17 ? ", hits soft " : ", stands on soft ") << rules.dealerStandsOn
+        << (rules.lateSurrender ? ", late surrender" : ", no surrender")
+        << ", full deck card weights.\n"
+           "//\n\n"
+           "#ifndef basic_strategy_table_hpp\n"
+           "#define basic_strategy_table_hpp\n\n"
+           "#include \"strategy_table.hpp\"\n\n\n"
+           "// Row = player total, bit = dealer upcard (2 to 11), set = hit\n"
+           "constexpr StrategyTable basicStrategyTable\n"
+           "{\n"
+           "    // hard totals\n    ";
+    writeRow(out, table.hard);
+    out << ",\n    // soft totals\n    ";
+    writeRow(out, table.soft);
+    out << ",\n    // hard totals to surrender, where the rules allow it\n    ";
+    writeRow(out, table.surrender);
+    out << "\n};\n\n"
+           "#endif /* basic_strategy_table_hpp */\n";
+}
+
+// Usage: generate_strategy [dealer stands on] [dealer hits soft 17 (0/1)] [late surrender (0/1)] [header path]
+int main(int argc, char *argv[])
+{
+    StrategyRules rules{};
+    if (argc > 1)
+        rules.dealerStandsOn = std::atoi(argv[1]);
+    if (argc > 2)
+        rules.dealerHitsSoft17 = std::atoi(argv[2]) != 0;
+    if (argc > 3)
+        rules.lateSurrender = std::atoi(argv[3]) != 0;
+
+    auto start{ std::chrono::steady_clock::now() };
+    BasicStrategyGenerator generator{ rules };
+    StrategyTable table{ generator.table() };
+    double handEv{ generator.handEv() };
+    std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+
+    printStrategyTable(table);
+    std::cout << "\n[INFO] - Expected value per hand = " << handEv;
+    std::cout << "\n[INFO] - Computed in " << elapsed.count() << " ms\n";
+
+    if (argc > 4)
+    {
+        std::ofstream header{ argv[4] };
+        writeStrategyHeader(header, table, rules);
+        std::cout << "[INFO] - Wrote " << argv[4] << "\n";
+    }
+    return 0;
+}
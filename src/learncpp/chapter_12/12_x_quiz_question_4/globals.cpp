@@ -41,4 +41,12 @@ public:
         return maxDealerValue;
     }
 };
+
+
+enum class BlackJackResult
+{
+    player_won,
+    dealer_won,
+    tie
+};
 #endif /* deck_hpp */
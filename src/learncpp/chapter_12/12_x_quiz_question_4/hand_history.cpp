@@ -0,0 +1,292 @@
+//
+//  hand_history.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "player.cpp"
+#include "simulation.hpp"
+#include "basic_strategy_table.hpp"
+#include "hand_history.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+
+/**
+ * Totals read back from a hand history file.
+ */
+struct HistoryTotals
+{
+    long long events{ 0 };
+    long long seeds{ 0 };
+    long long hands{ 0 };
+    long long cards{ 0 };
+    long long hits{ 0 };
+    long long stays{ 0 };
+    long long surrenders{ 0 };
+    long long results[3]{};
+    bool complete{ true };
+};
+
+
+/**
+ * Plays `hands` hands with basic strategy from a deck seeded with `seed`
+ * and appends them, after a seed record, to the history at `path`.
+ */
+int recordHistory(const char *path, long long hands, std::uint64_t seed)
+{
+    HandHistoryWriter writer{ path };
+    if (not writer.isOpen())
+    {
+        std::cout << "[ERROR] - Could not open " << path << " as a hand history\n";
+        return 1;
+    }
+
+    auto start{ std::chrono::steady_clock::now() };
+
+    writer.writeSeed(seed);
+    Deck deck{ seed };
+    deck.shuffle();
+    SimulationResult result{ simulate(deck, TableStrategy{ basicStrategyTable }, hands, writer) };
+    writer.flush();
+    if (not writer.ok())
+    {
+        std::cout << "[ERROR] - Could not write " << path << ": " << std::strerror(writer.error()) << "\n";
+        return 1;
+    }
+
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "[INFO] - Hands recorded = " << result.hands << "\n";
+    std::cout << "[INFO] - Bytes written  = " << writer.bytesWritten() << " ("
+              << static_cast<double>(writer.bytesWritten()) / result.hands << " per hand)\n";
+    std::cout << "[INFO] - Hands / second = " << static_cast<long long>(result.hands / elapsed.count()) << "\n";
+    return 0;
+}
+
+/**
+ * Scans the whole history at `path` and prints its totals.
+ */
+int scanHistory(const char *path)
+{
+    auto start{ std::chrono::steady_clock::now() };
+
+    HandHistoryReader reader{ path };
+    if (not reader.isValid())
+    {
+        std::cout << "[ERROR] - " << path << " is not a hand history file\n";
+        return 1;
+    }
+
+    HistoryTotals totals{};
+    HistoryEvent event{};
+    while (reader.next(event))
+    {
+        ++totals.events;
+        switch (event.kind)
+        {
+            case HistoryEvent::card_dealt:  ++totals.cards;                                 break;
+            case HistoryEvent::hand_begin:  ++totals.hands;                                 break;
+            case HistoryEvent::hit:         ++totals.hits;                                  break;
+            case HistoryEvent::stay:        ++totals.stays;                                 break;
+            case HistoryEvent::hand_end:    ++totals.results[static_cast<int>(event.result)]; break;
+            case HistoryEvent::seed:        ++totals.seeds;                                 break;
+            case HistoryEvent::surrender:   ++totals.surrenders;                            break;
+        }
+    }
+    totals.complete = totals.hands == totals.results[0] + totals.results[1] + totals.results[2];
+
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+    double megabytes{ reader.size() / (1024.0 * 1024.0) };
+
+    std::cout << "[INFO] - Seed records   = " << totals.seeds << "\n";
+    std::cout << "[INFO] - Hands          = " << totals.hands << (totals.complete ? "" : " (last hand cut short)") << "\n";
+    std::cout << "[INFO] - Cards dealt    = " << totals.cards << "\n";
+    std::cout << "[INFO] - Hits / stays   = " << totals.hits << " / " << totals.stays << "\n";
+    std::cout << "[INFO] - Surrenders     = " << totals.surrenders << "\n";
+    std::cout << "[INFO] - Player wins    = " << totals.results[static_cast<int>(BlackJackResult::player_won)] << "\n";
+    std::cout << "[INFO] - Dealer wins    = " << totals.results[static_cast<int>(BlackJackResult::dealer_won)] << "\n";
+    std::cout << "[INFO] - Ties           = " << totals.results[static_cast<int>(BlackJackResult::tie)] << "\n";
+    std::cout << "[INFO] - Scanned        = " << megabytes << " MB at " << megabytes / elapsed.count() << " MB/s\n";
+    return 0;
+}
+
+/**
+ * Scores every hand of the history at `path` from its recorded cards, with
+ * a `HandMask` per seat, and prints how often each side went bust.
+ *
+ * Each score is checked against the one `Player` keeps for the same cards;
+ * hands that repeat a card, which a mask cannot hold, are scored by
+ * `Player` alone. Fails if any score differs.
+ */
+int scoreHistory(const char *path)
+{
+    auto start{ std::chrono::steady_clock::now() };
+
+    HandHistoryReader reader{ path };
+    if (not reader.isValid())
+    {
+        std::cout << "[ERROR] - " << path << " is not a hand history file\n";
+        return 1;
+    }
+
+    long long hands{ 0 }, maskHands{ 0 }, mismatches{ 0 };
+    long long busts[2]{};
+    HandMask masks[2]{};
+    Player players[2]{};
+    bool distinct{ true };
+
+    HistoryEvent event{};
+    while (reader.next(event))
+    {
+        switch (event.kind)
+        {
+            case HistoryEvent::hand_begin:
+                masks[0] = masks[1] = HandMask{};
+                players[0] = players[1] = Player{};
+                distinct = true;
+                break;
+            case HistoryEvent::card_dealt:
+                distinct &= masks[event.seat].add(event.card);
+                players[event.seat].addCard(event.card.toCard());
+                break;
+            case HistoryEvent::hand_end:
+                ++hands;
+                maskHands += distinct;
+                for (int seat{0}; seat < 2; seat++)
+                {
+                    int score{ distinct ? masks[seat].score() : players[seat].score() };
+                    mismatches += score != players[seat].score();
+                    busts[seat] += score > Global::blackJack;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "[INFO] - Hands scored   = " << hands << " (" << maskHands << " by hand mask)\n";
+    std::cout << "[INFO] - Player busts   = " << busts[0] << "\n";
+    std::cout << "[INFO] - Dealer busts   = " << busts[dealerSeat] << "\n";
+    std::cout << "[INFO] - Hands / second = " << static_cast<long long>(hands / elapsed.count()) << "\n";
+
+    if (mismatches)
+    {
+        std::cout << "[ERROR] - " << mismatches << " hand mask scores differ from Player's\n";
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Prints the first `hands` hands of the history at `path` as text.
+ */
+int dumpHistory(const char *path, long long hands)
+{
+    HandHistoryReader reader{ path };
+    if (not reader.isValid())
+    {
+        std::cout << "[ERROR] - " << path << " is not a hand history file\n";
+        return 1;
+    }
+
+    static const char *resultText[]{ "player won", "dealer won", "tie" };
+
+    // Each hand is built up in `line` and written out in one go. A real
+    // hand has a few dozen events at most, but the file may be corrupt, so
+    // a line that fills up is written out early and carried on from there.
+    char line[1024];
+    constexpr std::ptrdiff_t longestEvent{ 32 };    // " -> dealer won\n" and the like
+    char *out{ line };
+    auto append = [&out](const char *text)
+    {
+        while (*text)
+            *out++ = *text++;
+    };
+
+    long long printed{ 0 };
+    HistoryEvent event{};
+    while (reader.next(event))
+    {
+        if (line + sizeof(line) - out < longestEvent)
+        {
+            std::cout.write(line, out - line);
+            out = line;
+        }
+
+        switch (event.kind)
+        {
+            case HistoryEvent::seed:
+                std::cout << "seed " << event.seedValue << "\n";
+                break;
+            case HistoryEvent::hand_begin:
+                if (printed++ == hands)
+                    return 0;
+                out = line;
+                append("hand:");
+                break;
+            case HistoryEvent::card_dealt:
+                append(event.seat == dealerSeat ? " D:" : " P:");
+                out = event.card.toCard().format(out);
+                break;
+            case HistoryEvent::hit:
+                append(" hit");
+                break;
+            case HistoryEvent::stay:
+                append(" stay");
+                break;
+            case HistoryEvent::surrender:
+                append(" surrender");
+                break;
+            case HistoryEvent::hand_end:
+                append(" -> ");
+                append(resultText[static_cast<int>(event.result)]);
+                *out++ = '\n';
+                std::cout.write(line, out - line);
+                out = line;
+                break;
+        }
+    }
+    return 0;
+}
+
+// Usage: hand_history record <path> [hands] [seed]
+//        hand_history scan <path>
+//        hand_history score <path>
+//        hand_history dump <path> [hands]
+int main(int argc, char *argv[])
+{
+    std::string mode{ argc > 1 ? argv[1] : "" };
+    if (argc < 3 or (mode != "record" and mode != "scan" and mode != "score" and mode != "dump"))
+    {
+        std::cout << "Usage: hand_history record <path> [hands] [seed]\n"
+                     "       hand_history scan <path>\n"
+                     "       hand_history score <path>\n"
+                     "       hand_history dump <path> [hands]\n";
+        return 1;
+    }
+
+    if (mode == "record")
+    {
+        long long hands{ argc > 3 ? std::atoll(argv[3]) : 1000000 };
+        std::uint64_t seed{ argc > 4 ? std::strtoull(argv[4], nullptr, 10) : seedFromDevice() };
+        return recordHistory(argv[2], hands, seed);
+    }
+    if (mode == "scan")
+        return scanHistory(argv[2]);
+    if (mode == "score")
+        return scoreHistory(argv[2]);
+
+    return dumpHistory(argv[2], argc > 3 ? std::atoll(argv[3]) : 10);
+}
@@ -0,0 +1,364 @@
+//
+//  hand_history.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef hand_history_hpp
+#define hand_history_hpp
+
+#include "globals.cpp"
+#include "card.hpp"
+#include "packed_card.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/**
+ * Binary hand history format.
+ *
+ * A file starts with the 4 byte magic "BJH1" and is followed by a stream of
+ * one byte events, appended hand after hand:
+ *
+ *   0sxxxxxx  card dealt: `s` is the seat (0 player, 1 dealer) and `xxxxxx`
+ *             the packed card code (rank * 4 + suit, below 52)
+ *   10000000  start of a hand
+ *   10000001  player hits
+ *   10000010  player stays
+ *   10000011  hand over, player won
+ *   10000100  hand over, dealer won
+ *   10000101  hand over, tie
+ *   10000110  seed record, followed by the seed as an unsigned LEB128 varint
+ *   10000111  player surrenders (rules with late surrender only)
+ *
+ * A typical hand takes under ten bytes and the format never needs a length
+ * or an index, so writers only ever append and readers scan forward.
+ */
+namespace history
+{
+    constexpr char magic[4]{ 'B', 'J', 'H', '1' };
+
+    enum Tag : std::uint8_t
+    {
+        tag_hand_begin = 0x80,
+        tag_hit,
+        tag_stay,
+        tag_player_won,
+        tag_dealer_won,
+        tag_tie,
+        tag_seed,
+        tag_surrender,
+    };
+
+    constexpr std::uint8_t tagBit{ 0x80 };
+    constexpr std::uint8_t seatBit{ 0x40 };
+    constexpr std::uint8_t cardMask{ 0x3F };
+
+    // Longest LEB128 encoding of a 64 bit value
+    constexpr std::size_t maxVarintBytes{ 10 };
+
+    inline std::uint8_t cardByte(int seat, const Card &card)
+    {
+        return static_cast<std::uint8_t>((seat ? seatBit : 0) | PackedCard{ card }.code());
+    }
+
+    inline std::uint8_t resultTag(BlackJackResult result)
+    {
+        return static_cast<std::uint8_t>(tag_player_won + static_cast<int>(result));
+    }
+
+    /**
+     * Writes `value` as a LEB128 varint at `out` and returns the number of
+     * bytes written
+     */
+    inline std::size_t putVarint(std::uint8_t *out, std::uint64_t value)
+    {
+        std::size_t size{ 0 };
+        while (value >= 0x80)
+        {
+            out[size++] = static_cast<std::uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        out[size++] = static_cast<std::uint8_t>(value);
+        return size;
+    }
+
+    /**
+     * Reads a LEB128 varint from [in, end) into `value` and returns the byte
+     * after it, or nullptr if the varint is cut short
+     */
+    inline const std::uint8_t *getVarint(const std::uint8_t *in, const std::uint8_t *end, std::uint64_t &value)
+    {
+        value = 0;
+        for (int shift{0}; in != end and shift < 64; shift += 7)
+        {
+            std::uint8_t byte{ *in++ };
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (not (byte & 0x80))
+                return in;
+        }
+        return nullptr;
+    }
+}
+
+
+/**
+ * Buffered, append only writer of a hand history file.
+ *
+ * Events collect in a fixed buffer and go to the file in large writes, so
+ * recording costs a few stores per event. The file is opened for appending
+ * and only gets the magic when it is empty, so later runs add to an
+ * existing history; a non-empty file that does not start with the magic
+ * is refused rather than appended to. A write that fails is not retried:
+ * the writer stops writing and `ok()` turns false for good, so the caller
+ * can tell the file is incomplete.
+ */
+class HandHistoryWriter
+{
+private:
+    int m_fd{ -1 };
+    std::array<std::uint8_t, 1 << 16> m_buffer{};
+    std::size_t m_used{ 0 };
+    long long m_bytesWritten{ 0 };
+    int m_error{ 0 };           // errno of the first failed write
+
+    void put(std::uint8_t byte)
+    {
+        if (m_used == m_buffer.size())
+            flush();
+        m_buffer[m_used++] = byte;
+    }
+
+public:
+    explicit HandHistoryWriter(const char *path)
+        : m_fd{ ::open(path, O_RDWR | O_CREAT | O_APPEND, 0644) }
+    {
+        struct stat info{};
+        if (m_fd < 0 or ::fstat(m_fd, &info) != 0)
+        {
+            close();
+            return;
+        }
+
+        if (info.st_size == 0)
+        {
+            for (char c : history::magic)
+                put(static_cast<std::uint8_t>(c));
+            return;
+        }
+
+        // Only ever append to something that is already a hand history
+        char magic[sizeof(history::magic)]{};
+        if (::pread(m_fd, magic, sizeof(magic), 0) != static_cast<ssize_t>(sizeof(magic)) or
+            std::memcmp(magic, history::magic, sizeof(magic)) != 0)
+            close();
+    }
+
+    HandHistoryWriter(const HandHistoryWriter &) = delete;
+    HandHistoryWriter &operator=(const HandHistoryWriter &) = delete;
+
+    ~HandHistoryWriter()
+    {
+        flush();
+        close();
+    }
+
+    bool isOpen() const { return m_fd >= 0; }
+    bool ok() const { return m_fd >= 0 and m_error == 0; }
+    int error() const { return m_error; }
+    long long bytesWritten() const { return m_bytesWritten + static_cast<long long>(m_used); }
+
+    void writeSeed(std::uint64_t seed)
+    {
+        if (m_buffer.size() - m_used < history::maxVarintBytes + 1)
+            flush();
+        m_buffer[m_used++] = history::tag_seed;
+        m_used += history::putVarint(&m_buffer[m_used], seed);
+    }
+
+    void deckSeeded(std::uint64_t seed) { writeSeed(seed); }
+    void beginHand() { put(history::tag_hand_begin); }
+    void cardDealt(int seat, const Card &card) { put(history::cardByte(seat, card)); }
+    void decision(bool hit) { put(hit ? history::tag_hit : history::tag_stay); }
+    void surrendered() { put(history::tag_surrender); }
+    void endHand(BlackJackResult result) { put(history::resultTag(result)); }
+
+    /**
+     * Hands the buffered events to the file. After a failed write nothing
+     * more is written and `ok()` returns false.
+     */
+    void flush()
+    {
+        std::size_t done{ 0 };
+        while (m_fd >= 0 and m_error == 0 and done < m_used)
+        {
+            ssize_t written{ ::write(m_fd, &m_buffer[done], m_used - done) };
+            if (written < 0 and errno == EINTR)
+                continue;
+            if (written <= 0)
+            {
+                m_error = written < 0 ? errno : EIO;
+                break;
+            }
+            done += static_cast<std::size_t>(written);
+        }
+        m_bytesWritten += static_cast<long long>(done);
+        m_used = 0;
+    }
+
+    void close()
+    {
+        if (m_fd >= 0)
+            ::close(m_fd);
+        m_fd = -1;
+    }
+};
+
+
+/**
+ * One decoded hand history event.
+ */
+struct HistoryEvent
+{
+    enum Kind
+    {
+        card_dealt,
+        hand_begin,
+        hit,
+        stay,
+        hand_end,
+        seed,
+        surrender,
+    };
+
+    Kind kind{ hand_begin };
+    int seat{ 0 };                  // card_dealt
+    PackedCard card{};              // card_dealt
+    BlackJackResult result{};       // hand_end
+    std::uint64_t seedValue{ 0 };   // seed
+};
+
+
+/**
+ * Reader of a hand history file mapped into memory.
+ *
+ * The file is never copied or parsed into text: `next()` decodes the mapped
+ * bytes in place, one event per call, and the kernel is told the mapping is
+ * read sequentially so it reads ahead at disk speed.
+ */
+class HandHistoryReader
+{
+private:
+    const std::uint8_t *m_begin{ nullptr };
+    const std::uint8_t *m_end{ nullptr };
+    const std::uint8_t *m_position{ nullptr };
+    std::size_t m_size{ 0 };
+    bool m_valid{ false };
+
+public:
+    explicit HandHistoryReader(const char *path)
+    {
+        int fd{ ::open(path, O_RDONLY) };
+        if (fd < 0)
+            return;
+
+        struct stat info{};
+        if (::fstat(fd, &info) == 0 and info.st_size >= static_cast<off_t>(sizeof(history::magic)))
+        {
+            m_size = static_cast<std::size_t>(info.st_size);
+            void *mapped{ ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0) };
+            if (mapped != MAP_FAILED)
+            {
+                ::madvise(mapped, m_size, MADV_SEQUENTIAL);
+                m_begin = static_cast<const std::uint8_t *>(mapped);
+                m_end = m_begin + m_size;
+                m_valid = std::memcmp(m_begin, history::magic, sizeof(history::magic)) == 0;
+            }
+        }
+        ::close(fd);
+        rewind();
+    }
+
+    HandHistoryReader(const HandHistoryReader &) = delete;
+    HandHistoryReader &operator=(const HandHistoryReader &) = delete;
+
+    ~HandHistoryReader()
+    {
+        if (m_begin)
+            ::munmap(const_cast<std::uint8_t *>(m_begin), m_size);
+    }
+
+    // True when the file could be mapped and starts with the magic
+    bool isValid() const { return m_valid; }
+    std::size_t size() const { return m_size; }
+
+    void rewind()
+    {
+        m_position = m_begin ? m_begin + sizeof(history::magic) : nullptr;
+    }
+
+    /**
+     * Decodes the next event into `event`. Returns false at the end of the
+     * file, or on a byte that is not part of the format.
+     */
+    bool next(HistoryEvent &event)
+    {
+        if (not m_valid or m_position == m_end)
+            return false;
+
+        std::uint8_t byte{ *m_position++ };
+        if (not (byte & history::tagBit))
+        {
+            event.kind = HistoryEvent::card_dealt;
+            event.seat = (byte & history::seatBit) ? 1 : 0;
+            event.card = PackedCard{ static_cast<std::uint8_t>(byte & history::cardMask) };
+            return event.card.code() < Global::cardsInADeck;
+        }
+
+        switch (byte)
+        {
+            case history::tag_hand_begin:
+                event.kind = HistoryEvent::hand_begin;
+                return true;
+            case history::tag_hit:
+                event.kind = HistoryEvent::hit;
+                return true;
+            case history::tag_stay:
+                event.kind = HistoryEvent::stay;
+                return true;
+            case history::tag_player_won:
+            case history::tag_dealer_won:
+            case history::tag_tie:
+                event.kind = HistoryEvent::hand_end;
+                event.result = static_cast<BlackJackResult>(byte - history::tag_player_won);
+                return true;
+            case history::tag_surrender:
+                event.kind = HistoryEvent::surrender;
+                return true;
+            case history::tag_seed:
+                event.kind = HistoryEvent::seed;
+                m_position = history::getVarint(m_position, m_end, event.seedValue);
+                if (not m_position)
+                {
+                    m_position = m_end;
+                    return false;
+                }
+                return true;
+            default:
+                return false;
+        }
+    }
+};
+
+#endif /* hand_history_hpp */
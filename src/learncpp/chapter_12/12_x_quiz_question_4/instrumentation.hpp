@@ -0,0 +1,455 @@
+//
+//  instrumentation.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef instrumentation_hpp
+#define instrumentation_hpp
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/**
+ * Hot path counters and latency histograms for the game engine.
+ *
+ * The hooks below are macros that only do something when the program is
+ * built with `-DBLACKJACK_INSTRUMENT`; otherwise they expand to nothing and
+ * the engine is compiled exactly as if they were not there.
+ *
+ * Every thread counts into its own `ThreadStats`, so the hot path never
+ * takes a lock or a locked instruction. A snapshot sums the stats of every
+ * live thread and of the threads that have finished, while they keep
+ * running.
+ */
+namespace instrument
+{
+#if defined(BLACKJACK_INSTRUMENT)
+    constexpr bool enabled{ true };
+#else
+    constexpr bool enabled{ false };
+#endif
+
+    enum CounterId
+    {
+        hands,
+        player_busts,
+        dealer_busts,
+        cards_dealt,
+        cards_drawn,
+        shuffles,
+        reshuffles,             // shuffles forced by running out of cards
+
+        counter_count
+    };
+
+    constexpr const char *counterNames[counter_count]
+    {
+        "hands", "player_busts", "dealer_busts", "cards_dealt", "cards_drawn", "shuffles", "reshuffles"
+    };
+
+    enum HistogramId
+    {
+        hand_latency,           // sampled, see `handSampleEvery`
+        shuffle_latency,        // sampled, see `shuffleSampleEvery`
+
+        histogram_count
+    };
+
+    constexpr const char *histogramNames[histogram_count]{ "hand_ns", "shuffle_ns" };
+
+    // Only one hand in this many is timed, as reading the clock costs a good
+    // part of what a whole hand does
+    constexpr std::uint64_t handSampleEvery{ 64 };
+
+    // A single deck is shuffled every ten hands or so, which makes timing
+    // every shuffle just as costly
+    constexpr std::uint64_t shuffleSampleEvery{ 16 };
+
+    // Bucket b of a histogram holds latencies in [2^(b-1), 2^b) ns, the
+    // last one everything longer
+    constexpr int bucketCount{ 40 };
+
+    inline int bucketOf(std::uint64_t nanoseconds)
+    {
+        if (nanoseconds == 0)
+            return 0;
+        return std::min(64 - __builtin_clzll(nanoseconds), bucketCount - 1);
+    }
+
+
+    /**
+     * A counter written by one thread and read by any. The owner adds with a
+     * plain load and store, no read-modify-write instruction needed.
+     */
+    class Counter
+    {
+    private:
+        std::atomic<std::uint64_t> m_value{ 0 };
+
+    public:
+        void add(std::uint64_t amount)
+        {
+            m_value.store(m_value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+        std::uint64_t value() const { return m_value.load(std::memory_order_relaxed); }
+    };
+
+    class Histogram
+    {
+    private:
+        Counter m_buckets[bucketCount];
+        Counter m_totalNanoseconds;
+
+    public:
+        void record(std::uint64_t nanoseconds)
+        {
+            m_buckets[bucketOf(nanoseconds)].add(1);
+            m_totalNanoseconds.add(nanoseconds);
+        }
+
+        std::uint64_t bucket(int b) const { return m_buckets[b].value(); }
+        std::uint64_t totalNanoseconds() const { return m_totalNanoseconds.value(); }
+    };
+
+    struct ThreadStats
+    {
+        Counter counters[counter_count];
+        Histogram histograms[histogram_count];
+    };
+
+
+    /**
+     * The values of a histogram at one point in time, or the difference
+     * between two such points.
+     */
+    struct HistogramSnapshot
+    {
+        std::uint64_t buckets[bucketCount]{};
+        std::uint64_t totalNanoseconds{ 0 };
+
+        std::uint64_t count() const
+        {
+            std::uint64_t total{ 0 };
+            for (std::uint64_t n : buckets)
+                total += n;
+            return total;
+        }
+
+        double mean() const
+        {
+            std::uint64_t n{ count() };
+            return n ? static_cast<double>(totalNanoseconds) / n : 0.0;
+        }
+
+        // Upper bound of the bucket holding quantile `q`, 0 if empty
+        std::uint64_t quantile(double q) const
+        {
+            std::uint64_t n{ count() };
+            if (n == 0)
+                return 0;
+            auto rank{ static_cast<std::uint64_t>(q * (n - 1)) + 1 };
+            std::uint64_t seen{ 0 };
+            for (int b{0}; b < bucketCount; b++)
+            {
+                seen += buckets[b];
+                if (seen >= rank)
+                    return std::uint64_t{ 1 } << b;
+            }
+            return std::uint64_t{ 1 } << (bucketCount - 1);
+        }
+
+        void add(const Histogram &histogram)
+        {
+            for (int b{0}; b < bucketCount; b++)
+                buckets[b] += histogram.bucket(b);
+            totalNanoseconds += histogram.totalNanoseconds();
+        }
+
+        HistogramSnapshot operator-(const HistogramSnapshot &earlier) const
+        {
+            HistogramSnapshot difference{ *this };
+            for (int b{0}; b < bucketCount; b++)
+                difference.buckets[b] -= earlier.buckets[b];
+            difference.totalNanoseconds -= earlier.totalNanoseconds;
+            return difference;
+        }
+    };
+
+    struct Snapshot
+    {
+        double seconds{ 0.0 };          // since the registry was created
+        int threads{ 0 };               // live threads counting
+        std::uint64_t counters[counter_count]{};
+        HistogramSnapshot histograms[histogram_count];
+
+        void add(const ThreadStats &stats)
+        {
+            for (int c{0}; c < counter_count; c++)
+                counters[c] += stats.counters[c].value();
+            for (int h{0}; h < histogram_count; h++)
+                histograms[h].add(stats.histograms[h]);
+        }
+    };
+
+
+    /**
+     * Keeps track of every thread's stats, and of what the threads that
+     * have exited counted.
+     */
+    class Registry
+    {
+    private:
+        std::mutex m_mutex;
+        std::vector<const ThreadStats *> m_live;
+        Snapshot m_retired{};
+        std::chrono::steady_clock::time_point m_start{ std::chrono::steady_clock::now() };
+
+    public:
+        static Registry &instance()
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        void add(const ThreadStats *stats)
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            m_live.push_back(stats);
+        }
+
+        void retire(const ThreadStats *stats)
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            m_retired.add(*stats);
+            m_live.erase(std::find(m_live.begin(), m_live.end(), stats));
+        }
+
+        Snapshot snapshot()
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            Snapshot result{ m_retired };
+            result.seconds = std::chrono::duration<double>{ std::chrono::steady_clock::now() - m_start }.count();
+            result.threads = static_cast<int>(m_live.size());
+            for (const ThreadStats *stats : m_live)
+                result.add(*stats);
+            return result;
+        }
+    };
+
+
+    // Registers the calling thread's stats for as long as the thread lives
+    struct ThreadSlot
+    {
+        ThreadStats stats;
+
+        ThreadSlot() { Registry::instance().add(&stats); }
+        ~ThreadSlot() { Registry::instance().retire(&stats); }
+    };
+
+    inline ThreadStats &local()
+    {
+        thread_local ThreadSlot slot;
+        return slot.stats;
+    }
+
+    inline Snapshot snapshot()
+    {
+        return Registry::instance().snapshot();
+    }
+
+
+    /**
+     * Times its own lifetime into `histogram`, or does nothing if given none
+     */
+    class ScopedTimer
+    {
+    private:
+        Histogram *m_histogram;
+        std::chrono::steady_clock::time_point m_start{};
+
+    public:
+        explicit ScopedTimer(Histogram *histogram)
+            : m_histogram{ histogram }
+        {
+            if (m_histogram)
+                m_start = std::chrono::steady_clock::now();
+        }
+
+        ~ScopedTimer()
+        {
+            if (m_histogram)
+            {
+                auto elapsed{ std::chrono::steady_clock::now() - m_start };
+                m_histogram->record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            }
+        }
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+    };
+
+    // The calling thread's `histogram` if its `counter` is at a multiple of
+    // `every`, nullptr otherwise
+    inline Histogram *sampled(HistogramId histogram, CounterId counter, std::uint64_t every)
+    {
+        ThreadStats &stats{ local() };
+        return stats.counters[counter].value() % every == 0 ? &stats.histograms[histogram] : nullptr;
+    }
+
+
+    /**
+     * One line describing what happened between `before` and `now`: counts
+     * and rates, then the median, 99th percentile and maximum latencies.
+     */
+    inline std::string formatText(const Snapshot &now, const Snapshot &before)
+    {
+        double seconds{ std::max(now.seconds - before.seconds, 1e-9) };
+        std::string text{ "[INFO] - " };
+        char field[96];
+
+        std::snprintf(field, sizeof(field), "t=%.2fs threads=%d", now.seconds, now.threads);
+        text += field;
+        for (int c{0}; c < counter_count; c++)
+        {
+            std::uint64_t delta{ now.counters[c] - before.counters[c] };
+            std::snprintf(field, sizeof(field), " %s=%llu (%.0f/s)", counterNames[c],
+                          static_cast<unsigned long long>(now.counters[c]), delta / seconds);
+            text += field;
+        }
+        for (int h{0}; h < histogram_count; h++)
+        {
+            HistogramSnapshot interval{ now.histograms[h] - before.histograms[h] };
+            std::snprintf(field, sizeof(field), " %s p50<=%llu p99<=%llu max<=%llu", histogramNames[h],
+                          static_cast<unsigned long long>(interval.quantile(0.5)),
+                          static_cast<unsigned long long>(interval.quantile(0.99)),
+                          static_cast<unsigned long long>(interval.quantile(1.0)));
+            text += field;
+        }
+        return text;
+    }
+
+    /**
+     * The same as `formatText()` as one JSON object, with the full bucket
+     * counts of the interval's histograms
+     */
+    inline std::string formatJson(const Snapshot &now, const Snapshot &before)
+    {
+        double seconds{ std::max(now.seconds - before.seconds, 1e-9) };
+        std::string json{ "{" };
+        char field[96];
+
+        std::snprintf(field, sizeof(field), "\"t\": %.3f, \"interval\": %.3f, \"threads\": %d",
+                      now.seconds, now.seconds - before.seconds, now.threads);
+        json += field;
+        for (int c{0}; c < counter_count; c++)
+        {
+            std::uint64_t delta{ now.counters[c] - before.counters[c] };
+            std::snprintf(field, sizeof(field), ", \"%s\": {\"total\": %llu, \"rate\": %.1f}", counterNames[c],
+                          static_cast<unsigned long long>(now.counters[c]), delta / seconds);
+            json += field;
+        }
+        for (int h{0}; h < histogram_count; h++)
+        {
+            HistogramSnapshot interval{ now.histograms[h] - before.histograms[h] };
+            std::snprintf(field, sizeof(field), ", \"%s\": {\"count\": %llu, \"mean\": %.1f, \"buckets\": [",
+                          histogramNames[h], static_cast<unsigned long long>(interval.count()), interval.mean());
+            json += field;
+            for (int b{0}; b < bucketCount; b++)
+            {
+                std::snprintf(field, sizeof(field), b ? ", %llu" : "%llu",
+                              static_cast<unsigned long long>(interval.buckets[b]));
+                json += field;
+            }
+            json += "]}";
+        }
+        json += "}";
+        return json;
+    }
+
+
+    /**
+     * Writes a snapshot line to `out` every `interval` from a thread of its
+     * own, and a last one when destroyed.
+     */
+    class SnapshotReporter
+    {
+    private:
+        std::ostream &m_out;
+        std::chrono::milliseconds m_interval;
+        bool m_json;
+        Snapshot m_previous{};
+        bool m_stopping{ false };
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::thread m_thread;
+
+        void report()
+        {
+            Snapshot now{ snapshot() };
+            m_out << (m_json ? formatJson(now, m_previous) : formatText(now, m_previous)) << std::endl;
+            m_previous = now;
+        }
+
+    public:
+        SnapshotReporter(std::ostream &out, std::chrono::milliseconds interval, bool json = false)
+            : m_out{ out }, m_interval{ interval }, m_json{ json }, m_previous{ snapshot() }
+        {
+            m_thread = std::thread{ [this]()
+            {
+                std::unique_lock<std::mutex> lock{ m_mutex };
+                while (not m_wake.wait_for(lock, m_interval, [this]() { return m_stopping; }))
+                    report();
+            } };
+        }
+
+        ~SnapshotReporter()
+        {
+            {
+                std::lock_guard<std::mutex> lock{ m_mutex };
+                m_stopping = true;
+            }
+            m_wake.notify_one();
+            m_thread.join();
+            report();
+        }
+    };
+}
+
+
+// Hooks for the engine's hot paths. They compile to nothing unless the
+// program is built with BLACKJACK_INSTRUMENT defined.
+#if defined(BLACKJACK_INSTRUMENT)
+
+#define INSTRUMENT_COUNT(counter, amount) \
+    (::instrument::local().counters[::instrument::counter].add(amount))
+
+#define INSTRUMENT_TIME(histogram) \
+    ::instrument::ScopedTimer instrumentTimer_##histogram{ &::instrument::local().histograms[::instrument::histogram] }
+
+#define INSTRUMENT_TIME_SAMPLED(histogram, counter, every) \
+    ::instrument::ScopedTimer instrumentTimer_##histogram{ ::instrument::sampled(::instrument::histogram, ::instrument::counter, every) }
+
+#else
+
+#define INSTRUMENT_COUNT(counter, amount) ((void)0)
+#define INSTRUMENT_TIME(histogram) ((void)0)
+#define INSTRUMENT_TIME_SAMPLED(histogram, counter, every) ((void)0)
+
+#endif
+
+#endif /* instrumentation_hpp */
@@ -0,0 +1,114 @@
+//
+//  lockstep_blackJack.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "shoe.cpp"
+#include "player.cpp"
+#include "simulation.hpp"
+#include "parallel_simulation.hpp"
+#include "rules_registry.hpp"
+#include "lockstep_hands.hpp"
+#include "strategy_names.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+
+/**
+ * Prints the totals one engine came to
+ */
+void printResult(const char *engine, const SimulationResult &result)
+{
+    std::cout << "[INFO] - " << engine << ": wins " << result.playerWins << ", losses " << result.dealerWins
+              << ", ties " << result.ties << ", busts " << result.playerBusts << " / " << result.dealerBusts
+              << ", blackjacks " << result.blackJacks << ", surrenders " << result.surrenders
+              << ", units " << result.playerUnits << "\n";
+}
+
+/**
+ * Plays the same hands with the scalar engine, one deck per lane after the
+ * other, and with `LockstepHands`, both under `Rules`, then checks they
+ * agree and prints both speeds.
+ */
+template <typename Rules, typename Strategy>
+int compareEngines(Strategy strategy, long long hands, std::uint64_t seed)
+{
+    long long rounds{ hands / lane::width };
+    std::array<std::uint64_t, lane::width> seeds{};
+    for (int i{0}; i < lane::width; i++)
+        seeds[i] = chunkSeed(seed, i);
+
+    auto start{ std::chrono::steady_clock::now() };
+    SimulationResult scalar{};
+    for (std::uint64_t laneSeed : seeds)
+    {
+        Deck deck{ laneSeed };
+        deck.shuffle();
+        scalar += simulate<Rules>(deck, strategy, rounds);
+    }
+    std::chrono::duration<double> scalarTime{ std::chrono::steady_clock::now() - start };
+
+    start = std::chrono::steady_clock::now();
+    LockstepHands<Rules> lockstep{ seeds, strategy };
+    SimulationResult vector{ lockstep.play(rounds) };
+    std::chrono::duration<double> lockstepTime{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "[INFO] - Hands per engine     = " << scalar.hands << "\n";
+    std::cout << "[INFO] - Lockstep backend     = " << lane::backend << ", " << lane::width << " lanes\n";
+    std::cout << "[INFO] - Scalar hands / sec   = " << static_cast<long long>(scalar.hands / scalarTime.count()) << "\n";
+    std::cout << "[INFO] - Lockstep hands / sec = " << static_cast<long long>(vector.hands / lockstepTime.count()) << "\n";
+
+    if (scalar != vector)
+    {
+        std::cout << "[ERROR] - Results differ\n";
+        printResult("Scalar  ", scalar);
+        printResult("Lockstep", vector);
+        return 1;
+    }
+
+    std::cout << "[INFO] - Results are identical\n";
+    return 0;
+}
+
+/**
+ * Compares the engines under `Rules` with the strategy named `strategy`,
+ * which `main()` has checked
+ */
+template <typename Rules>
+int compareEngines(const std::string &strategy, long long hands, std::uint64_t seed)
+{
+    int status{ 1 };
+    withStrategy(strategy, [&](auto visited) { status = compareEngines<Rules>(visited, hands, seed); });
+    return status;
+}
+
+// Usage: lockstep_blackJack [hands] [hit below | basic] [seed] [classic | s17-1d | h17-1d]
+int main(int argc, char *argv[])
+{
+    long long hands{ argc > 1 ? std::atoll(argv[1]) : 10000000 };
+    std::string strategy{ argc > 2 ? argv[2] : "basic" };
+    std::uint64_t seed{ argc > 3 ? std::strtoull(argv[3], nullptr, 10) : seedFromDevice() };
+    std::string rules{ argc > 4 ? argv[4] : "classic" };
+
+    if (not isStrategyName(strategy) or (rules != "classic" and rules != "s17-1d" and rules != "h17-1d"))
+    {
+        std::cout << "[ERROR] - Usage: lockstep_blackJack [hands] [hit below | basic] [seed] [classic | s17-1d | h17-1d]\n";
+        return 1;
+    }
+
+    std::cout << "[INFO] - Rules                = " << rules << "\n";
+    if (rules == "classic")
+        return compareEngines<ClassicRules>(strategy, hands, seed);
+    if (rules == "s17-1d")
+        return compareEngines<S17SingleDeck>(strategy, hands, seed);
+    return compareEngines<H17SingleDeck>(strategy, hands, seed);
+}
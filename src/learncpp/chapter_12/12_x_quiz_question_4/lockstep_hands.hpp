@@ -0,0 +1,327 @@
+//
+//  lockstep_hands.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef lockstep_hands_hpp
+#define lockstep_hands_hpp
+
+#include "globals.cpp"
+#include "card.hpp"
+#include "deck.hpp"
+#include "rules.hpp"
+#include "simulation.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+/**
+ * The handful of operations the lockstep kernels need, on `width` 32 bit
+ * lanes at once. Comparisons return masks with every bit of a lane set for
+ * true, so `both(mask, x)` keeps `x` only in the lanes where `mask` holds.
+ *
+ * Built with AVX2 (e.g. -mavx2 or -march=native) these map to single
+ * instructions. Otherwise they are plain loops over an array, which the
+ * compiler turns into SSE code where it can.
+ */
+namespace lane
+{
+    constexpr int width{ 8 };
+
+#if defined(__AVX2__)
+    constexpr const char *backend{ "AVX2" };
+
+    using Ints = __m256i;
+
+    inline Ints splat(std::int32_t value) { return _mm256_set1_epi32(value); }
+    inline Ints load(const std::int32_t *from) { return _mm256_load_si256(reinterpret_cast<const __m256i *>(from)); }
+    inline void store(std::int32_t *to, Ints value) { _mm256_store_si256(reinterpret_cast<__m256i *>(to), value); }
+    inline Ints add(Ints a, Ints b) { return _mm256_add_epi32(a, b); }
+    inline Ints sub(Ints a, Ints b) { return _mm256_sub_epi32(a, b); }
+    inline Ints mul(Ints a, Ints b) { return _mm256_mullo_epi32(a, b); }
+    inline Ints both(Ints a, Ints b) { return _mm256_and_si256(a, b); }
+    inline Ints either(Ints a, Ints b) { return _mm256_or_si256(a, b); }
+    inline Ints butNot(Ints a, Ints b) { return _mm256_andnot_si256(b, a); }
+    inline Ints greater(Ints a, Ints b) { return _mm256_cmpgt_epi32(a, b); }
+    inline Ints equal(Ints a, Ints b) { return _mm256_cmpeq_epi32(a, b); }
+    inline int bits(Ints mask) { return _mm256_movemask_ps(_mm256_castsi256_ps(mask)); }
+
+    inline Ints gather(const std::int32_t *base, Ints index)
+    {
+        return _mm256_i32gather_epi32(reinterpret_cast<const int *>(base), index, 4);
+    }
+#else
+    constexpr const char *backend{ "portable" };
+
+    struct Ints
+    {
+        std::int32_t value[width];
+    };
+
+    template <typename Operation>
+    inline Ints apply(Ints a, Ints b, Operation operation)
+    {
+        Ints result;
+        for (int i{0}; i < width; i++)
+            result.value[i] = operation(a.value[i], b.value[i]);
+        return result;
+    }
+
+    inline Ints splat(std::int32_t value)
+    {
+        Ints result;
+        for (int i{0}; i < width; i++)
+            result.value[i] = value;
+        return result;
+    }
+
+    inline Ints load(const std::int32_t *from)
+    {
+        Ints result;
+        for (int i{0}; i < width; i++)
+            result.value[i] = from[i];
+        return result;
+    }
+
+    inline void store(std::int32_t *to, Ints value)
+    {
+        for (int i{0}; i < width; i++)
+            to[i] = value.value[i];
+    }
+
+    inline Ints add(Ints a, Ints b) { return apply(a, b, [](std::int32_t x, std::int32_t y) { return x + y; }); }
+    inline Ints sub(Ints a, Ints b) { return apply(a, b, [](std::int32_t x, std::int32_t y) { return x - y; }); }
+    inline Ints mul(Ints a, Ints b) { return apply(a, b, [](std::int32_t x, std::int32_t y) { return x * y; }); }
+    inline Ints both(Ints a, Ints b) { return apply(a, b, [](std::int32_t x, std::int32_t y) { return x & y; }); }
+    inline Ints either(Ints a, Ints b) { return apply(a, b, [](std::int32_t x, std::int32_t y) { return x | y; }); }
+    inline Ints butNot(Ints a, Ints b) { return apply(a, b, [](std::int32_t x, std::int32_t y) { return x & ~y; }); }
+    inline Ints greater(Ints a, Ints b) { return apply(a, b, [](std::int32_t x, std::int32_t y) { return x > y ? -1 : 0; }); }
+    inline Ints equal(Ints a, Ints b) { return apply(a, b, [](std::int32_t x, std::int32_t y) { return x == y ? -1 : 0; }); }
+
+    inline int bits(Ints mask)
+    {
+        int result{ 0 };
+        for (int i{0}; i < width; i++)
+            result |= (mask.value[i] < 0) << i;
+        return result;
+    }
+
+    inline Ints gather(const std::int32_t *base, Ints index)
+    {
+        Ints result;
+        for (int i{0}; i < width; i++)
+            result.value[i] = base[index.value[i]];
+        return result;
+    }
+#endif
+
+    inline int count(Ints mask)
+    {
+        return __builtin_popcount(static_cast<unsigned>(bits(mask)));
+    }
+}
+
+
+/**
+ * Plays `lane::width` independent hands side by side, one per lane, each
+ * from its own `Deck`.
+ *
+ * The hands are kept as a structure of arrays, one vector each for the
+ * player's and dealer's totals and ace counts, the cards the player holds
+ * and every deck's position. Every step deals one card to each lane that
+ * still wants one and scores it the way `Player::addCard()` does, with
+ * masks standing in for the branches. The strategy becomes a table of masks
+ * read with a gather, so any strategy that only looks at the total, softness
+ * and upcard can drive it.
+ *
+ * Lane `i` plays exactly the hands `simulate()` plays from `Deck{ seeds[i] }`
+ * after one `shuffle()`, reshuffles included, and `play()` returns the same
+ * totals to the bit.
+ *
+ * @tparam Rules the table rules: any single deck rules without surrender
+ */
+template <typename Rules = ClassicRules>
+class LockstepHands
+{
+private:
+    static_assert(Rules::decks == 1, "every lane deals from a single Deck");
+    static_assert(not Rules::lateSurrender, "the lockstep kernels have no surrender step");
+
+    // Strategy mask table dimensions: soft, player total, dealer upcard
+    static constexpr int tableTotals{ 32 };
+    static constexpr int tableUpcards{ 12 };
+
+    std::vector<Deck> m_decks;
+    alignas(32) std::int32_t m_values[ Global::cardsInADeck * lane::width ];     // [card][lane]
+    alignas(32) std::int32_t m_cursor[ lane::width ]{};
+    alignas(32) std::int32_t m_hits[ 2 * tableTotals * tableUpcards ]{};         // -1 to hit
+
+    // Copies the card values of lane `i`'s deck into its column of `m_values`
+    void loadValues(int i)
+    {
+        const Card *cards{ m_decks[i].cards() };
+        for (int card{0}; card < Global::cardsInADeck; card++)
+            m_values[card * lane::width + i] = cards[card].value();
+    }
+
+    // Reshuffles the decks of the lanes in `wrapping` and returns the new
+    // cursors. As rare as a reshuffle is, it is done one lane at a time.
+    lane::Ints reshuffle(lane::Ints wrapping, lane::Ints cursor)
+    {
+        lane::store(m_cursor, cursor);
+        int lanes{ lane::bits(wrapping) };
+        for (int i{0}; i < lane::width; i++)
+        {
+            if (lanes & (1 << i))
+            {
+                m_decks[i].shuffle();
+                loadValues(i);
+                m_cursor[i] = 0;
+            }
+        }
+        return lane::load(m_cursor);
+    }
+
+public:
+    /**
+     * @param seeds the seed of every lane's deck
+     * @param strategy the player's hit/stay policy, asked once per total,
+     *      softness and upcard here and never again
+     */
+    template <typename Strategy>
+    LockstepHands(const std::array<std::uint64_t, lane::width> &seeds, Strategy strategy)
+    {
+        m_decks.reserve(lane::width);
+        for (int i{0}; i < lane::width; i++)
+        {
+            m_decks.emplace_back(seeds[i]);
+            m_decks[i].shuffle();
+            loadValues(i);
+        }
+
+        for (int soft{0}; soft < 2; soft++)
+        {
+            for (int total{0}; total < Global::blackJack; total++)
+            {
+                for (int upcard{2}; upcard < tableUpcards; upcard++)
+                {
+                    if (strategy(total, soft == 1, upcard))
+                        m_hits[(soft * tableTotals + total) * tableUpcards + upcard] = -1;
+                }
+            }
+        }
+    }
+
+    /**
+     * Plays `rounds` hands on every lane and returns the totals of all of them
+     */
+    SimulationResult play(long long rounds)
+    {
+        using namespace lane;
+
+        const Ints zero{ splat(0) };
+        const Ints all{ splat(-1) };
+        const Ints blackJack{ splat(Rules::blackJack) };
+        alignas(32) std::int32_t indices[ width ];
+        for (int i{0}; i < width; i++)
+            indices[i] = i;
+        const Ints lanes{ load(indices) };
+
+        Ints cursor{ load(m_cursor) };
+
+        // Deals a card to every lane in `drawing` and scores it into
+        // `score` and `aces` like `Player::addCard()`
+        auto draw = [&](Ints drawing, Ints &score, Ints &aces)
+        {
+            // `Deck::dealCard()` reshuffles rather than deal the last card
+            Ints wrapping{ both(drawing, equal(cursor, splat(Global::cardsInADeck - 1))) };
+            if (bits(wrapping))
+                cursor = reshuffle(wrapping, cursor);
+
+            Ints value{ both(drawing, gather(m_values, add(mul(cursor, splat(width)), lanes))) };
+            cursor = sub(cursor, drawing);
+
+            score = add(score, value);
+            aces = sub(aces, equal(value, splat(11)));
+
+            Ints soften{ both(drawing, both(greater(score, blackJack), greater(aces, zero))) };
+            score = sub(score, both(soften, splat(10)));
+            aces = add(aces, soften);
+        };
+
+        SimulationResult result{};
+
+        for (long long round{0}; round < rounds; round++)
+        {
+            Ints playerScore{ zero };
+            Ints playerAces{ zero };
+            Ints dealerScore{ zero };
+            Ints dealerAces{ zero };
+
+            draw(all, playerScore, playerAces);
+            draw(all, dealerScore, dealerAces);
+            Ints upcard{ dealerScore };
+            Ints playerCards{ splat(1) };
+
+            // Player hits while below `blackJack` and the strategy says so
+            while (true)
+            {
+                Ints soft{ both(greater(playerAces, zero), splat(tableTotals * tableUpcards)) };
+                Ints row{ add(soft, add(mul(playerScore, splat(tableUpcards)), upcard)) };
+                Ints hitting{ both(greater(blackJack, playerScore), gather(m_hits, row)) };
+                if (not bits(hitting))
+                    break;
+                draw(hitting, playerScore, playerAces);
+                playerCards = sub(playerCards, hitting);
+            }
+
+            // Dealer hits the hands the player has not bust until the rules
+            // say stand
+            Ints playerBust{ greater(playerScore, blackJack) };
+            while (true)
+            {
+                Ints below{ greater(splat(Rules::dealerStandsOn), dealerScore) };
+                if constexpr (Rules::dealerHitsSoft17)
+                    below = either(below, both(equal(dealerScore, splat(Rules::dealerStandsOn)),
+                                               greater(dealerAces, zero)));
+                Ints hitting{ butNot(below, playerBust) };
+                if (not bits(hitting))
+                    break;
+                draw(hitting, dealerScore, dealerAces);
+            }
+
+            Ints dealerBust{ butNot(greater(dealerScore, blackJack), playerBust) };
+            Ints won{ butNot(either(dealerBust, greater(playerScore, dealerScore)), playerBust) };
+            Ints lost{ either(playerBust, butNot(greater(dealerScore, playerScore), dealerBust)) };
+            Ints natural{ both(won, both(equal(playerCards, splat(2)), equal(playerScore, blackJack))) };
+
+            int wins{ count(won) };
+            int losses{ count(lost) };
+            result.playerWins += wins;
+            result.dealerWins += losses;
+            result.ties += width - wins - losses;
+            result.playerBusts += count(playerBust);
+            result.dealerBusts += count(dealerBust);
+            result.blackJacks += count(natural);
+        }
+
+        store(m_cursor, cursor);
+
+        result.hands = rounds * width;
+        result.playerUnits = static_cast<double>(result.playerWins - result.blackJacks)
+                           + result.blackJacks * Rules::blackJackPayout
+                           - static_cast<double>(result.dealerWins);
+        return result;
+    }
+};
+
+#endif /* lockstep_hands_hpp */
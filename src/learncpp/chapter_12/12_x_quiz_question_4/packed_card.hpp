@@ -0,0 +1,213 @@
+//
+//  packed_card.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef packed_card_hpp
+#define packed_card_hpp
+
+#include "globals.cpp"
+#include "card.hpp"
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+
+namespace packed
+{
+    constexpr int suitCount{ Card::max_suits };
+    constexpr int rankCount{ Card::max_rank };
+
+    // Per code lookup tables, indexed by rank * 4 + suit, built from the
+    // per rank and per suit tables of the `cards` library
+    constexpr std::array<std::uint8_t, Global::cardsInADeck> makeValueTable()
+    {
+        std::array<std::uint8_t, Global::cardsInADeck> table{};
+        for (int code{0}; code < Global::cardsInADeck; code++)
+            table[code] = static_cast<std::uint8_t>(cards::rankValues[code / suitCount]);
+        return table;
+    }
+
+    constexpr std::array<std::array<char, 2>, Global::cardsInADeck> makeTextTable()
+    {
+        std::array<std::array<char, 2>, Global::cardsInADeck> table{};
+        for (int code{0}; code < Global::cardsInADeck; code++)
+            table[code] = { cards::rankSymbols[code / suitCount], cards::suitSymbols[code % suitCount] };
+        return table;
+    }
+
+    constexpr auto valueTable{ makeValueTable() };
+    constexpr auto textTable{ makeTextTable() };
+
+    // Bit k of card code c is set in plane k if the hard value of c (aces
+    // counting 1) has bit k set, so that
+    // hard total = sum over k of 2^k * popcount(mask & plane k)
+    constexpr std::uint64_t valuePlane(int bit)
+    {
+        std::uint64_t plane{ 0 };
+        for (int code{0}; code < Global::cardsInADeck; code++)
+        {
+            int hardValue{ valueTable[code] == 11 ? 1 : valueTable[code] };
+            if ((hardValue >> bit) & 1)
+                plane |= std::uint64_t{ 1 } << code;
+        }
+        return plane;
+    }
+
+    constexpr std::uint64_t valuePlanes[4]{ valuePlane(0), valuePlane(1), valuePlane(2), valuePlane(3) };
+    constexpr std::uint64_t acePlane{ std::uint64_t{ 0xF } << (Card::rank_ace * suitCount) };
+
+    inline int popCount(std::uint64_t bits)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(bits);
+#else
+        return static_cast<int>(std::bitset<64>{ bits }.count());
+#endif
+    }
+}
+
+
+/**
+ * A card stored in one byte as rank * 4 + suit. The four suits of a rank are
+ * neighbours, so every rank owns one nibble of a 64 bit hand mask. An 8 deck
+ * shoe of packed cards is 416 bytes, seven cache lines.
+ */
+class PackedCard
+{
+private:
+    std::uint8_t m_code{ 0 };
+
+public:
+    constexpr PackedCard() = default;
+
+    constexpr explicit PackedCard(std::uint8_t code)
+        : m_code{ code }
+    {
+    }
+
+    constexpr PackedCard(Card::Rank rank, Card::Suit suit)
+        : m_code{ static_cast<std::uint8_t>(rank * packed::suitCount + suit) }
+    {
+    }
+
+    constexpr explicit PackedCard(const Card &card)
+        : PackedCard(card.rank(), card.suit())
+    {
+    }
+
+    constexpr std::uint8_t code() const { return m_code; }
+    constexpr Card::Rank rank() const { return static_cast<Card::Rank>(m_code / packed::suitCount); }
+    constexpr Card::Suit suit() const { return static_cast<Card::Suit>(m_code % packed::suitCount); }
+    constexpr int value() const { return packed::valueTable[m_code]; }
+    constexpr char rankChar() const { return packed::textTable[m_code][0]; }
+    constexpr char suitChar() const { return packed::textTable[m_code][1]; }
+
+    Card toCard() const { return { rank(), suit() }; }
+};
+
+static_assert(sizeof(PackedCard) == 1, "a packed card must fit in one byte");
+
+
+/**
+ * A hand held as a set of cards in one 64 bit mask, bit `code` standing for
+ * the packed card `code`.
+ *
+ * Counting and scoring never branch on the cards: the hard total is a
+ * weighted popcount, done as one popcount per bit of the card values, and
+ * the soft ace is added arithmetically. The mask describes one deck's worth
+ * of distinct cards; the same card twice (possible in a multi-deck shoe)
+ * is rejected by `add()` and has to be scored through `Player` instead.
+ *
+ * `hand_history score` scores every recorded hand this way.
+ */
+class HandMask
+{
+private:
+    std::uint64_t m_mask{ 0 };
+
+public:
+    constexpr HandMask() = default;
+
+    constexpr explicit HandMask(std::uint64_t mask)
+        : m_mask{ mask }
+    {
+    }
+
+    constexpr std::uint64_t mask() const { return m_mask; }
+
+    bool contains(PackedCard card) const
+    {
+        return (m_mask >> card.code()) & 1;
+    }
+
+    /**
+     * Adds `card` to the hand, returns false if it was already there
+     */
+    bool add(PackedCard card)
+    {
+        std::uint64_t bit{ std::uint64_t{ 1 } << card.code() };
+        bool isNew{ (m_mask & bit) == 0 };
+        m_mask |= bit;
+        return isNew;
+    }
+
+    void remove(PackedCard card)
+    {
+        m_mask &= ~(std::uint64_t{ 1 } << card.code());
+    }
+
+    int count() const
+    {
+        return packed::popCount(m_mask);
+    }
+
+    int countRank(Card::Rank rank) const
+    {
+        return packed::popCount(m_mask & (std::uint64_t{ 0xF } << (rank * packed::suitCount)));
+    }
+
+    int aceCount() const
+    {
+        return packed::popCount(m_mask & packed::acePlane);
+    }
+
+    /**
+     * Returns the total with every ace counted as 1
+     */
+    int hardTotal() const
+    {
+        return packed::popCount(m_mask & packed::valuePlanes[0]) +
+               2 * packed::popCount(m_mask & packed::valuePlanes[1]) +
+               4 * packed::popCount(m_mask & packed::valuePlanes[2]) +
+               8 * packed::popCount(m_mask & packed::valuePlanes[3]);
+    }
+
+    /**
+     * Returns true if one ace can count as 11 without busting
+     */
+    bool isSoft() const
+    {
+        return ((m_mask & packed::acePlane) != 0) & (hardTotal() <= Global::blackJack - 10);
+    }
+
+    /**
+     * Returns the best total of the hand, at most one ace counting as 11.
+     *
+     * This is the score `Player` keeps for any hand that only ever hit
+     * below 21, which is every hand the engine plays. `Player` takes one
+     * ace back to 1 per card added, so a hand hit at 21 can part ways:
+     * A, 10, A is 22 there and 12 here.
+     */
+    int score() const
+    {
+        int hard{ hardTotal() };
+        return hard + 10 * (((m_mask & packed::acePlane) != 0) & (hard <= Global::blackJack - 10));
+    }
+};
+
+#endif /* packed_card_hpp */
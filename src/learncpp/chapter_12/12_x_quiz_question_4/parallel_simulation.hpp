@@ -0,0 +1,119 @@
+//
+//  parallel_simulation.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef parallel_simulation_hpp
+#define parallel_simulation_hpp
+
+#include "simulation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+// Hands are handed out to workers in fixed size chunks. Every chunk gets its
+// own deck seeded from the master seed and the chunk number, so the totals of
+// a run only depend on the master seed and never on the number of threads.
+constexpr long long handsPerChunk{ 1 << 16 };
+
+
+/**
+ * Returns the seed of chunk `chunk` of a run started with `masterSeed`.
+ * Uses the splitmix64 finalizer so neighbouring chunks get unrelated seeds.
+ */
+inline std::uint64_t chunkSeed(std::uint64_t masterSeed, long long chunk)
+{
+    std::uint64_t z{ masterSeed + 0x9E3779B97F4A7C15ULL * static_cast<std::uint64_t>(chunk + 1) };
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+
+// One worker's running totals, padded to a cache line of its own so that
+// workers updating their counters never invalidate each other's lines.
+struct alignas(64) WorkerResult
+{
+    SimulationResult result{};
+};
+
+
+/**
+ * Plays chunk `chunk` of a run: a fresh deck seeded for the chunk plays up
+ * to `handsPerChunk` hands.
+ *
+ * @param strategy the player's hit/stay policy
+ * @param hands total number of hands in the run
+ * @param masterSeed seed the run was started with
+ * @param chunk index of the chunk to play
+ */
+template <typename Strategy>
+SimulationResult simulateChunk(Strategy strategy, long long hands,
+                               std::uint64_t masterSeed, long long chunk)
+{
+    long long first{ chunk * handsPerChunk };
+    long long count{ std::min(handsPerChunk, hands - first) };
+
+    Deck deck{ chunkSeed(masterSeed, chunk) };
+    deck.shuffle();
+
+    return simulate(deck, strategy, count);
+}
+
+
+/**
+ * Plays `hands` hands spread over `threads` worker threads.
+ *
+ * Workers claim chunks from a shared counter, so a slow thread never holds
+ * back the others, and the per worker totals are summed once every thread
+ * has joined.
+ *
+ * @param strategy the player's hit/stay policy, copied into every chunk
+ * @param hands number of hands to play
+ * @param masterSeed seed the chunk seeds are derived from
+ * @param threads number of worker threads, 0 for one per core
+ */
+template <typename Strategy>
+SimulationResult simulateParallel(Strategy strategy, long long hands,
+                                  std::uint64_t masterSeed, int threads = 0)
+{
+    if (threads <= 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    long long chunks{ (hands + handsPerChunk - 1) / handsPerChunk };
+    std::atomic<long long> nextChunk{ 0 };
+    std::vector<WorkerResult> workerResults(threads);
+    std::vector<std::thread> workers;
+
+    for (int w{0}; w < threads; w++)
+    {
+        workers.emplace_back([&, w]()
+        {
+            SimulationResult local{};
+            long long chunk{};
+
+            while ((chunk = nextChunk.fetch_add(1, std::memory_order_relaxed)) < chunks)
+                local += simulateChunk(strategy, hands, masterSeed, chunk);
+
+            workerResults[w].result = local;
+        });
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+
+    SimulationResult total{};
+    for (const auto &workerResult : workerResults)
+        total += workerResult.result;
+
+    return total;
+}
+
+#endif /* parallel_simulation_hpp */
@@ -7,11 +7,12 @@
 //
 
 #include "globals.cpp"
-#include "card.cpp"
 #include "deck.cpp"
 #include "player.cpp"
 #include "play_blackJack.hpp"
 
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
 
 
@@ -57,10 +58,14 @@ void decideWinner(BlackJackResult result)
         std::cout << "\n[INFO] - The game is a tie !" << "\n";
 }
 
-int main()
+// Usage: play_blackJack [seed]
+int main(int argc, char *argv[])
 {
-    // Create deck of cards and shuffle
-    Deck deck{};
+    // Create deck of cards and shuffle. Playing again with the printed seed
+    // and the same answers replays the same game
+    std::uint64_t seed{ argc > 1 ? std::strtoull(argv[1], nullptr, 10) : seedFromDevice() };
+    std::cout << "[INFO] - Game seed = " << seed;
+    Deck deck{ seed };
     deck.shuffle();
     
     // Create player and dealer objects
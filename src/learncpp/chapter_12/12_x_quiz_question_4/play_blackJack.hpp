@@ -9,15 +9,9 @@
 #ifndef play_blackJack_hpp
 #define play_blackJack_hpp
 
-#include <iostream>
-
+#include "instrumentation.hpp"
 
-enum class BlackJackResult
-{
-    player_won,
-    dealer_won,
-    tie
-};
+#include <iostream>
 
 
 /**
@@ -62,6 +56,8 @@ void displayPlayerScore(int total, bool dealerIsPlaying = false)
 
 int play(Deck &deck, Player &player, bool dealerIsPlaying = false)
 {
+    if (not dealerIsPlaying)
+        INSTRUMENT_COUNT(hands, 1);
     
     int cardValue = player.drawCard(deck);
     displayPlayerScore(player.score(), dealerIsPlaying);
@@ -100,6 +96,11 @@ int play(Deck &deck, Player &player, bool dealerIsPlaying = false)
                 keepPlaying = 0;
         }
     }
+    
+    if (player.isBust() and dealerIsPlaying)
+        INSTRUMENT_COUNT(dealer_busts, 1);
+    else if (player.isBust())
+        INSTRUMENT_COUNT(player_busts, 1);
     return player.score();
 }
 
@@ -14,12 +14,12 @@
 /**
  * Updates player score and ace count
  *
- * @param deck a class  holding information of cards in the deck
+ * @param card the card dealt to the player
  */
-int Player::drawCard(Deck& deck)
+int Player::addCard(const Card& card)
 {
-    // Deal a card from the deck and update player score
-    int cardValue { deck.dealCard().value() };
+    // Update player score with the value of the dealt card
+    int cardValue { card.value() };
     m_score += cardValue;
     
     // Update ace count if `cardValue` == 11
@@ -42,6 +42,14 @@ bool Player::isBust() const
     return (m_score > Global::blackJack);
 }
 
+/**
+ * Returns true if an ace is still being counted as 11 in the player's score
+ */
+bool Player::isSoft() const
+{
+    return (m_aceCount > 0);
+}
+
 int Player::score() const
 {
     return m_score;
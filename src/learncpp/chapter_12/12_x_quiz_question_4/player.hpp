@@ -10,6 +10,7 @@
 #define player_hpp
 
 #include "deck.hpp"
+#include "instrumentation.hpp"
 
 
 class Player
@@ -22,7 +23,19 @@ public:
     Player() = default;
     int score() const;
     bool isBust() const;
-    int drawCard(Deck& deck);
+    bool isSoft() const;
+    int addCard(const Card& card);
+    
+    /**
+     * Deals a card from `source` (a `Deck`, a `Shoe`, ...) into the hand and
+     * returns its value
+     */
+    template <typename CardSource>
+    int drawCard(CardSource& source)
+    {
+        INSTRUMENT_COUNT(cards_drawn, 1);
+        return addCard(source.dealCard());
+    }
     
 };
 #endif /* player_hpp */
@@ -0,0 +1,66 @@
+//
+//  process_blackJack.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "player.cpp"
+#include "parallel_simulation.hpp"
+#include "process_simulation.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+
+// Usage: process_blackJack [hands] [processes] [master seed] [shard to crash]
+int main(int argc, char *argv[])
+{
+    long long hands{ argc > 1 ? std::atoll(argv[1]) : 50000000 };
+    ProcessOptions options{};
+    options.processes = argc > 2 ? std::atoi(argv[2]) : 0;
+    std::uint64_t masterSeed{ argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 2022 };
+    options.crashShard = argc > 4 ? std::atoi(argv[4]) : -1;
+
+    // Nothing buffered may be flushed twice once the workers are forked
+    std::cout.flush();
+
+    ProcessStats stats{};
+    auto start{ std::chrono::steady_clock::now() };
+    SimulationResult result{ simulateProcesses(HitBelowStrategy{}, hands, masterSeed, options, stats) };
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    if (not stats.sharedMemory)
+    {
+        std::cout << "[ERROR] - Could not set up the shared memory segment\n";
+        return 1;
+    }
+
+    std::cout << "[INFO] - Hands = " << result.hands << " in " << elapsed.count() << " s, "
+              << static_cast<long long>(result.hands / elapsed.count()) << " hands / sec\n";
+    std::cout << "[INFO] - Workers restarted = " << stats.restarts << "\n";
+    std::cout << "[INFO] - Player wins = " << result.playerWins
+              << ", dealer wins = " << result.dealerWins
+              << ", ties = " << result.ties << "\n";
+    std::cout << "[INFO] - Player units = " << std::fixed << std::setprecision(1) << result.playerUnits << "\n";
+
+    if (stats.failedShards)
+    {
+        std::cout << "[ERROR] - " << stats.failedShards << " shards never finished\n";
+        return 1;
+    }
+
+    SimulationResult threaded{ simulateParallel(HitBelowStrategy{}, hands, masterSeed) };
+    if (result != threaded)
+    {
+        std::cout << "[ERROR] - Totals differ from the threaded run\n";
+        return 1;
+    }
+    std::cout << "[INFO] - Totals match the threaded run\n";
+    return 0;
+}
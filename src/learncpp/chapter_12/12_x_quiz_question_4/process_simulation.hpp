@@ -0,0 +1,269 @@
+//
+//  process_simulation.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef process_simulation_hpp
+#define process_simulation_hpp
+
+#include "simulation.hpp"
+#include "parallel_simulation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+/**
+ * Shared memory layout of a multi-process run.
+ *
+ * Every shard owns a slot it alone writes to. After each chunk the worker
+ * writes its running totals into the copy of the slot that is not
+ * published, then publishes it with one atomic store of the chunk count
+ * and the copy's index. A worker killed half way through a write only
+ * ever spoils the copy nobody reads.
+ */
+namespace shard
+{
+    static_assert(std::atomic<long long>::is_always_lock_free and
+                  std::atomic<std::uint64_t>::is_always_lock_free,
+                  "atomics shared between processes must not need a lock");
+
+    struct Totals
+    {
+        std::atomic<long long> counts[8];
+        std::atomic<std::uint64_t> playerUnits;     // bits of the double
+    };
+
+    struct alignas(64) Slot
+    {
+        Totals copies[2];
+        std::atomic<std::uint64_t> published{ 0 };  // chunks done << 1 | copy holding them
+    };
+
+    inline long long chunksDone(const Slot &slot)
+    {
+        return static_cast<long long>(slot.published.load(std::memory_order_acquire) >> 1);
+    }
+
+    inline SimulationResult read(const Slot &slot)
+    {
+        const Totals &copy{ slot.copies[slot.published.load(std::memory_order_acquire) & 1] };
+
+        SimulationResult result{};
+        long long *fields[]{ &result.hands, &result.playerWins, &result.dealerWins, &result.ties,
+                             &result.playerBusts, &result.dealerBusts, &result.blackJacks, &result.surrenders };
+        for (int i{0}; i < 8; i++)
+            *fields[i] = copy.counts[i].load(std::memory_order_relaxed);
+
+        std::uint64_t units{ copy.playerUnits.load(std::memory_order_relaxed) };
+        std::memcpy(&result.playerUnits, &units, sizeof(units));
+        return result;
+    }
+
+    inline void publish(Slot &slot, long long chunksDone, const SimulationResult &result)
+    {
+        std::uint64_t copyIndex{ (slot.published.load(std::memory_order_relaxed) & 1) ^ 1 };
+        Totals &copy{ slot.copies[copyIndex] };
+
+        long long fields[]{ result.hands, result.playerWins, result.dealerWins, result.ties,
+                            result.playerBusts, result.dealerBusts, result.blackJacks, result.surrenders };
+        for (int i{0}; i < 8; i++)
+            copy.counts[i].store(fields[i], std::memory_order_relaxed);
+
+        std::uint64_t units{};
+        std::memcpy(&units, &result.playerUnits, sizeof(units));
+        copy.playerUnits.store(units, std::memory_order_relaxed);
+
+        slot.published.store((static_cast<std::uint64_t>(chunksDone) << 1) | copyIndex, std::memory_order_release);
+    }
+
+
+    /**
+     * A POSIX shared memory segment holding `count` slots, mapped before
+     * any worker is forked so that every worker inherits it. The name is
+     * unlinked as soon as it is mapped, so nothing is left behind however
+     * the run ends.
+     */
+    class Segment
+    {
+    private:
+        Slot *m_slots{ nullptr };
+        std::size_t m_bytes{ 0 };
+
+    public:
+        explicit Segment(int count)
+            : m_bytes{ sizeof(Slot) * static_cast<std::size_t>(count) }
+        {
+            std::string name{ "/blackjack_shards_" + std::to_string(::getpid()) };
+            int fd{ ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600) };
+            if (fd < 0)
+                return;
+
+            void *memory{ MAP_FAILED };
+            if (::ftruncate(fd, static_cast<off_t>(m_bytes)) == 0)
+                memory = ::mmap(nullptr, m_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::shm_unlink(name.c_str());
+            ::close(fd);
+
+            if (memory == MAP_FAILED)
+                return;
+
+            m_slots = static_cast<Slot *>(memory);
+            for (int s{0}; s < count; s++)
+                new (&m_slots[s]) Slot{};
+        }
+
+        Segment(const Segment &) = delete;
+        Segment &operator=(const Segment &) = delete;
+
+        ~Segment()
+        {
+            if (m_slots)
+                ::munmap(m_slots, m_bytes);
+        }
+
+        bool isOpen() const { return m_slots != nullptr; }
+        Slot &operator[](int shard) { return m_slots[shard]; }
+    };
+}
+
+
+struct ProcessOptions
+{
+    int processes{ 0 };             // 0 for one per core
+    int maxRestarts{ 3 };           // per shard
+    int crashShard{ -1 };           // kills this shard half way on its first run, for testing
+};
+
+struct ProcessStats
+{
+    int restarts{ 0 };
+    int failedShards{ 0 };          // shards left unfinished, e.g. after `maxRestarts`
+    bool sharedMemory{ true };      // false if the segment could not be set up
+};
+
+
+/**
+ * Plays the chunks of shard `shard` that it has not published yet, then
+ * exits. Runs in a forked worker and never returns.
+ */
+template <typename Strategy>
+[[noreturn]] void runShard(Strategy strategy, long long hands, std::uint64_t masterSeed,
+                           long long firstChunk, long long lastChunk, shard::Slot &slot, bool crashHalfWay)
+{
+    long long done{ shard::chunksDone(slot) };
+    SimulationResult totals{ shard::read(slot) };
+
+    for (long long chunk{ firstChunk + done }; chunk < lastChunk; chunk++)
+    {
+        if (crashHalfWay and done == (lastChunk - firstChunk) / 2)
+            ::kill(::getpid(), SIGKILL);
+
+        totals += simulateChunk(strategy, hands, masterSeed, chunk);
+        shard::publish(slot, ++done, totals);
+    }
+    ::_exit(0);
+}
+
+/**
+ * Plays `hands` hands spread over forked worker processes, one shard of
+ * consecutive chunks each, and returns the merged totals.
+ *
+ * Chunks are seeded exactly as in `simulateParallel()`, so both give the
+ * same totals for the same master seed. A worker that dies is forked
+ * again and carries on from the first chunk it had not published: that
+ * chunk's deck is rebuilt from its seed, so nothing is lost or counted
+ * twice.
+ *
+ * @param strategy the player's hit/stay policy, copied into every worker
+ * @param hands number of hands to play
+ * @param masterSeed seed the chunk seeds are derived from
+ * @param options number of processes, restart limit and crash testing
+ * @param stats counts the restarts and the shards that never finished
+ */
+template <typename Strategy>
+SimulationResult simulateProcesses(Strategy strategy, long long hands, std::uint64_t masterSeed,
+                                   const ProcessOptions &options, ProcessStats &stats)
+{
+    long long chunks{ (hands + handsPerChunk - 1) / handsPerChunk };
+    int shards{ options.processes > 0 ? options.processes : static_cast<int>(std::max(1L, ::sysconf(_SC_NPROCESSORS_ONLN))) };
+    shards = static_cast<int>(std::max(1LL, std::min<long long>(shards, chunks)));
+
+    shard::Segment segment{ shards };
+    if (not segment.isOpen())
+    {
+        stats.sharedMemory = false;
+        return {};
+    }
+
+    auto firstChunk = [&](int s) { return chunks * s / shards; };
+
+    std::vector<pid_t> pids(shards, -1);
+    std::vector<int> runs(shards, 0);
+
+    // Forks a worker for shard `s`, returns false if no process could be made
+    auto start = [&](int s)
+    {
+        bool crash{ s == options.crashShard and runs[s] == 0 };
+        ++runs[s];
+
+        pid_t pid{ ::fork() };
+        if (pid == 0)
+            runShard(strategy, hands, masterSeed, firstChunk(s), firstChunk(s + 1), segment[s], crash);
+        pids[s] = pid;
+        return pid > 0;
+    };
+
+    int running{ 0 };
+    for (int s{0}; s < shards; s++)
+        running += start(s) ? 1 : 0;
+
+    while (running > 0)
+    {
+        int status{};
+        pid_t pid{ ::wait(&status) };
+        if (pid < 0)
+            break;
+
+        auto found{ std::find(pids.begin(), pids.end(), pid) };
+        if (found == pids.end())
+            continue;
+        int s{ static_cast<int>(found - pids.begin()) };
+        --running;
+        *found = -1;
+
+        bool finished{ shard::chunksDone(segment[s]) == firstChunk(s + 1) - firstChunk(s) };
+        if (finished and WIFEXITED(status) and WEXITSTATUS(status) == 0)
+            continue;
+
+        if (runs[s] > options.maxRestarts)
+            continue;
+        ++stats.restarts;
+        running += start(s) ? 1 : 0;
+    }
+
+    SimulationResult total{};
+    for (int s{0}; s < shards; s++)
+    {
+        if (shard::chunksDone(segment[s]) != firstChunk(s + 1) - firstChunk(s))
+            ++stats.failedShards;
+        total += shard::read(segment[s]);
+    }
+    return total;
+}
+
+#endif /* process_simulation_hpp */
@@ -0,0 +1,200 @@
+//
+//  random_engines.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef random_engines_hpp
+#define random_engines_hpp
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+
+
+/**
+ * SplitMix64, only used to expand one 64 bit seed into the state of the
+ * bigger engines below.
+ */
+class SplitMix64
+{
+private:
+    std::uint64_t m_state{ 0 };
+
+public:
+    using result_type = std::uint64_t;
+
+    explicit SplitMix64(std::uint64_t seed = 0)
+        : m_state{ seed }
+    {
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()()
+    {
+        std::uint64_t z{ m_state += 0x9E3779B97F4A7C15ULL };
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+};
+
+
+/**
+ * PCG32 (XSH-RR variant): 16 bytes of state, 32 bit output.
+ */
+class Pcg32
+{
+private:
+    std::uint64_t m_state{ 0 };
+    std::uint64_t m_increment{ 0 };
+
+public:
+    using result_type = std::uint32_t;
+
+    explicit Pcg32(std::uint64_t seed = 0x853C49E6748FEA9BULL, std::uint64_t stream = 0xDA3E39CB94B95BDBULL)
+        : m_increment{ (stream << 1u) | 1u }
+    {
+        (*this)();
+        m_state += seed;
+        (*this)();
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()()
+    {
+        std::uint64_t oldState{ m_state };
+        m_state = oldState * 6364136223846793005ULL + m_increment;
+
+        auto xorShifted{ static_cast<std::uint32_t>(((oldState >> 18u) ^ oldState) >> 27u) };
+        auto rotation{ static_cast<std::uint32_t>(oldState >> 59u) };
+        return (xorShifted >> rotation) | (xorShifted << ((32u - rotation) & 31u));
+    }
+};
+
+
+/**
+ * xoshiro256**: 32 bytes of state, 64 bit output.
+ */
+class Xoshiro256StarStar
+{
+private:
+    std::uint64_t m_state[4]{};
+
+    static std::uint64_t rotl(std::uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+public:
+    using result_type = std::uint64_t;
+
+    explicit Xoshiro256StarStar(std::uint64_t seed = 0)
+    {
+        SplitMix64 seeder{ seed };
+        for (auto &word : m_state)
+            word = seeder();
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()()
+    {
+        std::uint64_t result{ rotl(m_state[1] * 5, 7) * 9 };
+        std::uint64_t t{ m_state[1] << 17 };
+
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
+
+        return result;
+    }
+};
+
+
+/**
+ * Returns a uniformly distributed integer in [0, bound) using Lemire's
+ * multiply-shift method: one multiplication in the common case and a
+ * rejection step only for the few values that would bias the result.
+ *
+ * Engines producing the full 32 or 64 bit range take the fast path, any
+ * other UniformRandomBitGenerator falls back to the standard distribution.
+ *
+ * @param engine the random engine to draw from
+ * @param bound exclusive upper limit, must be greater than 0
+ */
+template <typename Engine>
+std::uint32_t boundedRandom(Engine &engine, std::uint32_t bound)
+{
+    constexpr auto engineMin{ static_cast<std::uint64_t>(Engine::min()) };
+    constexpr auto engineMax{ static_cast<std::uint64_t>(Engine::max()) };
+
+    if constexpr (engineMin == 0 and (engineMax == 0xFFFFFFFFULL or engineMax == 0xFFFFFFFFFFFFFFFFULL))
+    {
+        // Keep the high bits of 64 bit engines, they are the best ones
+        auto next32 = [&engine]()
+        {
+            if constexpr (engineMax == 0xFFFFFFFFULL)
+                return static_cast<std::uint32_t>(engine());
+            else
+                return static_cast<std::uint32_t>(static_cast<std::uint64_t>(engine()) >> 32);
+        };
+
+        std::uint64_t product{ static_cast<std::uint64_t>(next32()) * bound };
+        auto low{ static_cast<std::uint32_t>(product) };
+
+        if (low < bound)
+        {
+            std::uint32_t threshold{ static_cast<std::uint32_t>(-bound) % bound };
+            while (low < threshold)
+            {
+                product = static_cast<std::uint64_t>(next32()) * bound;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+    else
+    {
+        std::uniform_int_distribution<std::uint32_t> distribution{ 0, bound - 1 };
+        return distribution(engine);
+    }
+}
+
+
+/**
+ * Fisher-Yates shuffle of `count` elements starting at `first`, drawing the
+ * swap positions with `boundedRandom()`.
+ */
+template <typename T, typename Engine>
+void shuffleCards(T *first, int count, Engine &engine)
+{
+    for (int i{ count - 1 }; i > 0; i--)
+    {
+        auto j{ boundedRandom(engine, static_cast<std::uint32_t>(i + 1)) };
+        std::swap(first[i], first[j]);
+    }
+}
+
+
+/**
+ * Returns a 64 bit seed read from the system's random device.
+ */
+inline std::uint64_t seedFromDevice()
+{
+    std::random_device rd;
+    return (static_cast<std::uint64_t>(rd()) << 32) | rd();
+}
+
+#endif /* random_engines_hpp */
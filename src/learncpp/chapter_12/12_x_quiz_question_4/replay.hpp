@@ -0,0 +1,179 @@
+//
+//  replay.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef replay_hpp
+#define replay_hpp
+
+#include "globals.cpp"
+#include "deck.hpp"
+#include "simulation.hpp"
+#include "hand_history.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * Decision policy that plays back the hit/stay decisions recorded for one
+ * hand instead of deciding anything. Once the recording runs out it stays,
+ * and remembers that it had to. A recorded surrender is played back the
+ * first time the engine offers one.
+ */
+class ReplayStrategy
+{
+private:
+    const bool *m_decisions{ nullptr };
+    std::size_t m_count{ 0 };
+    std::size_t m_next{ 0 };
+    bool m_surrendered{ false };
+    bool m_ranOut{ false };
+
+public:
+    ReplayStrategy(const bool *decisions, std::size_t count, bool surrendered = false)
+        : m_decisions{ decisions }, m_count{ count }, m_surrendered{ surrendered }
+    {
+    }
+
+    bool surrender(int /*playerScore*/, bool /*isSoft*/, int /*dealerUpcard*/)
+    {
+        bool surrender{ m_surrendered and m_next == m_count };
+        if (surrender)
+            m_surrendered = false;
+        return surrender;
+    }
+
+    bool operator()(int /*playerScore*/, bool /*isSoft*/, int /*dealerUpcard*/)
+    {
+        if (m_next == m_count)
+        {
+            m_ranOut = true;
+            return false;
+        }
+        return m_decisions[m_next++];
+    }
+
+    // True when every recorded decision was used and no more were asked for
+    bool matchedRecording() const { return m_next == m_count and not m_ranOut and not m_surrendered; }
+};
+
+
+/**
+ * Totals of a replayed history.
+ */
+struct ReplayResult
+{
+    SimulationResult result{};
+    long long seeds{ 0 };
+    long long skippedHands{ 0 };    // hands before any seed record, or cut short
+    long long resultChanges{ 0 };   // hands ending differently than recorded
+    long long decisionChanges{ 0 }; // hands asking for other decisions than recorded
+};
+
+
+/**
+ * Rebuilds every hand in a hand history from its seed record and decision
+ * stream, without reading the recorded cards and without any I/O.
+ *
+ * A seed record stands for the deck `Deck{ seed }` after one `shuffle()`, as
+ * the recorder deals from, and hands are played from it with the recorded
+ * decisions in order. Replaying under the rules the history was recorded
+ * with gives back the same cards and results; after a rules change the
+ * recorded decisions are replayed as they were and any hand that now ends
+ * differently is counted.
+ *
+ * @tparam Rules the rules to replay under, `ClassicRules` unless given
+ * @param reader the history to replay, read from its start
+ * @param observer receives the events of every replayed hand
+ */
+template <typename Rules = ClassicRules, typename Observer = NullObserver>
+ReplayResult replayHistory(HandHistoryReader &reader, Observer &&observer = {})
+{
+    ReplayResult replay{};
+    Deck deck{ std::uint64_t{ 0 } };
+    bool seeded{ false };
+
+    // Decisions of the hand being read; a hand never has more than one per
+    // card the player can hold
+    std::array<bool, 2 * Global::blackJack> decisions{};
+    std::size_t decisionCount{ 0 };
+    bool surrendered{ false };
+    bool inHand{ false };
+    bool handUsable{ false };
+
+    reader.rewind();
+    HistoryEvent event{};
+    while (reader.next(event))
+    {
+        switch (event.kind)
+        {
+            case HistoryEvent::seed:
+                if (inHand)
+                    ++replay.skippedHands;
+                deck = Deck{ event.seedValue };
+                deck.shuffle();
+                observer.deckSeeded(event.seedValue);
+                seeded = true;
+                inHand = false;
+                ++replay.seeds;
+                break;
+
+            case HistoryEvent::hand_begin:
+                if (inHand)
+                    ++replay.skippedHands;
+                inHand = true;
+                handUsable = seeded;
+                decisionCount = 0;
+                surrendered = false;
+                break;
+
+            case HistoryEvent::surrender:
+                surrendered = true;
+                break;
+
+            case HistoryEvent::hit:
+            case HistoryEvent::stay:
+                if (decisionCount == decisions.size())
+                    handUsable = false;
+                else
+                    decisions[decisionCount++] = (event.kind == HistoryEvent::hit);
+                break;
+
+            case HistoryEvent::hand_end:
+            {
+                if (not inHand)
+                    break;
+                inHand = false;
+                if (not handUsable)
+                {
+                    ++replay.skippedHands;
+                    break;
+                }
+
+                ReplayStrategy strategy{ decisions.data(), decisionCount, surrendered };
+                BlackJackResult result{ playHand<Rules>(deck, strategy, replay.result, observer) };
+                if (result != event.result)
+                    ++replay.resultChanges;
+                if (not strategy.matchedRecording())
+                    ++replay.decisionChanges;
+                break;
+            }
+
+            case HistoryEvent::card_dealt:
+                // The cards come from the seeded deck, the recorded ones are
+                // only there for readers of the history
+                break;
+        }
+    }
+
+    if (inHand)
+        ++replay.skippedHands;
+    return replay;
+}
+
+#endif /* replay_hpp */
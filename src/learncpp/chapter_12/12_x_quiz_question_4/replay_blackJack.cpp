@@ -0,0 +1,74 @@
+//
+//  replay_blackJack.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "player.cpp"
+#include "simulation.hpp"
+#include "hand_history.hpp"
+#include "replay.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+
+// Usage: replay_blackJack <history path> [rewritten history path]
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::cout << "Usage: replay_blackJack <history path> [rewritten history path]\n";
+        return 1;
+    }
+
+    HandHistoryReader reader{ argv[1] };
+    if (not reader.isValid())
+    {
+        std::cout << "[ERROR] - " << argv[1] << " is not a hand history file\n";
+        return 1;
+    }
+
+    auto start{ std::chrono::steady_clock::now() };
+
+    ReplayResult replay{};
+    if (argc > 2)
+    {
+        // Writes the replayed hands back out; with unchanged rules the new
+        // file is byte for byte the original
+        HandHistoryWriter writer{ argv[2] };
+        if (not writer.isOpen())
+        {
+            std::cout << "[ERROR] - Could not open " << argv[2] << " as a hand history\n";
+            return 1;
+        }
+        replay = replayHistory(reader, writer);
+        writer.flush();
+        if (not writer.ok())
+        {
+            std::cout << "[ERROR] - Could not write " << argv[2] << ": " << std::strerror(writer.error()) << "\n";
+            return 1;
+        }
+    }
+    else
+        replay = replayHistory(reader);
+
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    const SimulationResult &result{ replay.result };
+    std::cout << "[INFO] - Seed records     = " << replay.seeds << "\n";
+    std::cout << "[INFO] - Hands replayed   = " << result.hands << "\n";
+    std::cout << "[INFO] - Hands skipped    = " << replay.skippedHands << "\n";
+    std::cout << "[INFO] - Player wins      = " << result.playerWins << "\n";
+    std::cout << "[INFO] - Dealer wins      = " << result.dealerWins << "\n";
+    std::cout << "[INFO] - Ties             = " << result.ties << "\n";
+    std::cout << "[INFO] - Results changed  = " << replay.resultChanges << "\n";
+    std::cout << "[INFO] - Decisions off    = " << replay.decisionChanges << "\n";
+    std::cout << "[INFO] - Hands / second   = " << static_cast<long long>(result.hands / elapsed.count()) << "\n";
+    return 0;
+}
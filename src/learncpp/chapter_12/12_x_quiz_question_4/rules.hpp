@@ -0,0 +1,95 @@
+//
+//  rules.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef rules_hpp
+#define rules_hpp
+
+#include "globals.cpp"
+#include "basic_strategy.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+
+/**
+ * A set of table rules, fixed at compile time.
+ *
+ * The simulation engine takes the rules as a template argument, so every
+ * variant gets its own copy of the inner loop with the dealer's rule, the
+ * payout and the surrender check folded into constants.
+ *
+ * @tparam DealerStandsOn lowest total the dealer stands on
+ * @tparam DealerHitsSoft17 whether the dealer hits a soft `DealerStandsOn`
+ * @tparam Decks number of decks dealt from, 1 being the single `Deck`
+ * @tparam PayoutNumerator over `PayoutDenominator`: what a winning two card
+ *      21 pays, 1/1 being no bonus as in the console game
+ * @tparam LateSurrender whether the player may give up half the bet on the
+ *      first two card decision
+ */
+template <int DealerStandsOn, bool DealerHitsSoft17, int Decks,
+          int PayoutNumerator, int PayoutDenominator, bool LateSurrender>
+struct RulesPolicy
+{
+    static constexpr int blackJack{ Global::blackJack };
+    static constexpr int dealerStandsOn{ DealerStandsOn };
+    static constexpr bool dealerHitsSoft17{ DealerHitsSoft17 };
+    static constexpr int decks{ Decks };
+    static constexpr double blackJackPayout{ static_cast<double>(PayoutNumerator) / PayoutDenominator };
+    static constexpr bool lateSurrender{ LateSurrender };
+
+    static_assert(Decks > 0, "a table needs at least one deck");
+
+    static constexpr bool dealerStands(int score, bool isSoft)
+    {
+        if (dealerHitsSoft17 and isSoft and score == dealerStandsOn)
+            return false;
+        return score >= dealerStandsOn;
+    }
+
+    // The same rules in the runtime form the strategy generator takes
+    static StrategyRules strategyRules()
+    {
+        StrategyRules rules{};
+        rules.dealerStandsOn = dealerStandsOn;
+        rules.dealerHitsSoft17 = dealerHitsSoft17;
+        rules.lateSurrender = lateSurrender;
+        return rules;
+    }
+};
+
+// The rules the console game has always played: one deck, dealer stands on
+// all 17s, a two card 21 pays even money and no surrender
+using ClassicRules = RulesPolicy<Global::maxDealerValue, false, 1, 1, 1, false>;
+
+
+namespace rules_detail
+{
+    template <typename Strategy, typename = void>
+    struct CanSurrender : std::false_type {};
+
+    template <typename Strategy>
+    struct CanSurrender<Strategy, std::void_t<decltype(std::declval<Strategy &>().surrender(0, false, 0))>>
+        : std::true_type {};
+}
+
+/**
+ * Asks `strategy` whether to surrender, for strategies that have a
+ * `surrender(playerScore, isSoft, dealerUpcard)` member. Any other strategy
+ * never surrenders.
+ */
+template <typename Strategy>
+bool wantsSurrender(Strategy &strategy, int playerScore, bool isSoft, int dealerUpcard)
+{
+    if constexpr (rules_detail::CanSurrender<Strategy>::value)
+        return strategy.surrender(playerScore, isSoft, dealerUpcard);
+    else
+        return false;
+}
+
+#endif /* rules_hpp */
@@ -0,0 +1,72 @@
+//
+//  rules_blackJack.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "shoe.cpp"
+#include "player.cpp"
+#include "rules_registry.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+
+/**
+ * Runs `variant` and prints one line of results.
+ */
+void runVariant(const RulesVariant &variant, long long hands, std::uint64_t seed)
+{
+    auto start{ std::chrono::steady_clock::now() };
+    SimulationResult result{ variant.simulate(hands, seed) };
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::cout << std::left << std::setw(13) << variant.name << std::right << std::fixed
+              << std::setprecision(5) << std::setw(10) << result.expectedValue()
+              << std::setw(12) << result.blackJacks
+              << std::setw(12) << result.surrenders
+              << std::setprecision(0) << std::setw(14) << result.hands / elapsed.count()
+              << "   " << variant.description << "\n";
+}
+
+// Usage: rules_blackJack [variant | all | list] [hands] [seed]
+int main(int argc, char *argv[])
+{
+    std::string name{ argc > 1 ? argv[1] : "all" };
+    long long hands{ argc > 2 ? std::atoll(argv[2]) : 1000000 };
+    std::uint64_t seed{ argc > 3 ? std::strtoull(argv[3], nullptr, 10) : seedFromDevice() };
+
+    if (name == "list")
+    {
+        for (const auto &variant : rulesVariants)
+            std::cout << std::left << std::setw(13) << variant.name << variant.description << "\n";
+        return 0;
+    }
+
+    const RulesVariant *only{ nullptr };
+    if (name != "all" and not (only = findRulesVariant(name.c_str())))
+    {
+        std::cout << "[ERROR] - Unknown rules variant " << name << ", try `list`\n";
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(13) << "variant" << std::right << std::setw(10) << "EV/hand"
+              << std::setw(12) << "blackjacks" << std::setw(12) << "surrenders"
+              << std::setw(14) << "hands/sec" << "\n";
+
+    if (only)
+        runVariant(*only, hands, seed);
+    else
+    {
+        for (const auto &variant : rulesVariants)
+            runVariant(variant, hands, seed);
+    }
+    return 0;
+}
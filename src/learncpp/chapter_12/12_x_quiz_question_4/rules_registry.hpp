@@ -0,0 +1,103 @@
+//
+//  rules_registry.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef rules_registry_hpp
+#define rules_registry_hpp
+
+#include "globals.cpp"
+#include "deck.hpp"
+#include "shoe.hpp"
+#include "rules.hpp"
+#include "basic_strategy.hpp"
+#include "strategy_table.hpp"
+#include "simulation.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+
+/**
+ * Returns a freshly shuffled card source for `Rules`: the single `Deck` of
+ * the console game for one deck, a `Shoe` otherwise.
+ */
+template <typename Rules>
+auto makeCardSource(std::uint64_t seed)
+{
+    if constexpr (Rules::decks == 1)
+    {
+        Deck deck{ seed };
+        deck.shuffle();
+        return deck;
+    }
+    else
+        return Shoe{ Rules::decks, 0, seed };
+}
+
+/**
+ * Plays `hands` hands under `Rules` with the basic strategy generated for
+ * those rules, surrendering where the rules allow it and the strategy says so.
+ */
+template <typename Rules>
+SimulationResult simulateRules(long long hands, std::uint64_t seed)
+{
+    BasicStrategyGenerator generator{ Rules::strategyRules() };
+    StrategyTable table{ generator.table() };
+
+    auto source{ makeCardSource<Rules>(seed) };
+    return simulate<Rules>(source, TableStrategy{ table }, hands);
+}
+
+
+/**
+ * One pre-instantiated rules variant, found by name at run time.
+ */
+struct RulesVariant
+{
+    const char *name;
+    const char *description;
+    SimulationResult (*simulate)(long long hands, std::uint64_t seed);
+};
+
+//                           stands on, hits soft 17, decks, payout, surrender
+using S17SixDecks          = RulesPolicy<17, false, 6, 3, 2, false>;
+using H17SixDecks          = RulesPolicy<17, true,  6, 3, 2, false>;
+using S17SixDecksSurrender = RulesPolicy<17, false, 6, 3, 2, true>;
+using H17SixDecksSurrender = RulesPolicy<17, true,  6, 3, 2, true>;
+using H17SixDecksSixToFive = RulesPolicy<17, true,  6, 6, 5, false>;
+using S17SingleDeck        = RulesPolicy<17, false, 1, 3, 2, false>;
+using H17SingleDeck        = RulesPolicy<17, true,  1, 3, 2, false>;
+using H17EightDecks        = RulesPolicy<17, true,  8, 3, 2, true>;
+
+constexpr RulesVariant rulesVariants[]
+{
+    { "classic",     "1 deck, S17, 21 pays 1:1, no surrender (the console game)", simulateRules<ClassicRules> },
+    { "s17-6d",      "6 decks, S17, 3:2, no surrender",                           simulateRules<S17SixDecks> },
+    { "h17-6d",      "6 decks, H17, 3:2, no surrender",                           simulateRules<H17SixDecks> },
+    { "s17-6d-ls",   "6 decks, S17, 3:2, late surrender",                         simulateRules<S17SixDecksSurrender> },
+    { "h17-6d-ls",   "6 decks, H17, 3:2, late surrender",                         simulateRules<H17SixDecksSurrender> },
+    { "h17-6d-6to5", "6 decks, H17, 6:5, no surrender",                           simulateRules<H17SixDecksSixToFive> },
+    { "s17-1d",      "1 deck, S17, 3:2, no surrender",                            simulateRules<S17SingleDeck> },
+    { "h17-1d",      "1 deck, H17, 3:2, no surrender",                            simulateRules<H17SingleDeck> },
+    { "h17-8d-ls",   "8 decks, H17, 3:2, late surrender",                         simulateRules<H17EightDecks> },
+};
+
+/**
+ * Returns the variant called `name`, or nullptr if there is none
+ */
+inline const RulesVariant *findRulesVariant(const char *name)
+{
+    for (const auto &variant : rulesVariants)
+    {
+        if (std::strcmp(variant.name, name) == 0)
+            return &variant;
+    }
+    return nullptr;
+}
+
+#endif /* rules_registry_hpp */
@@ -0,0 +1,79 @@
+//
+//  running_stats.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef running_stats_hpp
+#define running_stats_hpp
+
+#include <cmath>
+
+
+/**
+ * Streaming mean and variance of a series of samples (Welford's method).
+ *
+ * Every sample updates the mean and the sum of squared deviations from it
+ * directly, so no samples are kept and the result does not lose precision
+ * the way a running sum of squares does over billions of hands.
+ */
+class RunningStats
+{
+private:
+    long long m_count{ 0 };
+    double m_mean{ 0.0 };
+    double m_squares{ 0.0 };        // sum of squared deviations from the mean
+
+public:
+    void add(double sample)
+    {
+        ++m_count;
+        double delta{ sample - m_mean };
+        m_mean += delta / m_count;
+        m_squares += delta * (sample - m_mean);
+    }
+
+    /**
+     * Adds every sample `other` has seen, as if they had been added here
+     * (Chan et al.'s pairwise update)
+     */
+    void merge(const RunningStats &other)
+    {
+        if (other.m_count == 0)
+            return;
+
+        long long count{ m_count + other.m_count };
+        double delta{ other.m_mean - m_mean };
+        m_mean += delta * other.m_count / count;
+        m_squares += other.m_squares + delta * delta * (static_cast<double>(m_count) * other.m_count / count);
+        m_count = count;
+    }
+
+    long long count() const { return m_count; }
+
+    double mean() const { return m_mean; }
+
+    // Sample variance, 0 until there are two samples
+    double variance() const
+    {
+        return m_count > 1 ? m_squares / (m_count - 1) : 0.0;
+    }
+
+    double standardError() const
+    {
+        return m_count > 1 ? std::sqrt(variance() / m_count) : 0.0;
+    }
+
+    /**
+     * Half the width of the normal confidence interval on the mean, e.g.
+     * `z` = 1.96 for 95%
+     */
+    double halfWidth(double z = 1.96) const
+    {
+        return z * standardError();
+    }
+};
+
+#endif /* running_stats_hpp */
@@ -0,0 +1,65 @@
+//
+//  scale_blackJack.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "player.cpp"
+#include "parallel_simulation.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+
+// Usage: scale_blackJack [hands] [master seed] [max threads]
+int main(int argc, char *argv[])
+{
+    long long hands{ argc > 1 ? std::atoll(argv[1]) : 20000000 };
+    std::uint64_t masterSeed{ argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2022 };
+    int maxThreads{ argc > 3 ? std::atoi(argv[3])
+                             : static_cast<int>(std::max(1u, std::thread::hardware_concurrency())) };
+
+    std::cout << "[INFO] - Scaling report, " << hands << " hands, master seed " << masterSeed << "\n\n";
+    std::cout << std::setw(8) << "threads" << std::setw(16) << "hands/sec"
+              << std::setw(10) << "speedup" << std::setw(12) << "same totals" << "\n";
+
+    // Powers of two up to the core count, plus the core count itself
+    std::vector<int> threadCounts;
+    for (int threads{1}; threads < maxThreads; threads *= 2)
+        threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    SimulationResult reference{};
+    double baseline{ 0.0 };
+
+    for (int threads : threadCounts)
+    {
+        auto start{ std::chrono::steady_clock::now() };
+        SimulationResult result{ simulateParallel(HitBelowStrategy{}, hands, masterSeed, threads) };
+        std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+        double handsPerSecond{ result.hands / elapsed.count() };
+        if (threads == 1)
+        {
+            reference = result;
+            baseline = handsPerSecond;
+        }
+
+        std::cout << std::setw(8) << threads
+                  << std::setw(16) << static_cast<long long>(handsPerSecond)
+                  << std::setw(10) << std::fixed << std::setprecision(2) << handsPerSecond / baseline
+                  << std::setw(12) << (result == reference ? "yes" : "NO") << "\n";
+    }
+
+    std::cout << "\n[INFO] - Player wins = " << reference.playerWins
+              << ", dealer wins = " << reference.dealerWins
+              << ", ties = " << reference.ties << "\n";
+    return 0;
+}
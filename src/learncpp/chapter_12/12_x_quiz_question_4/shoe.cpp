@@ -0,0 +1,160 @@
+//
+//  shoe.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "shoe.hpp"
+#include "card.hpp"
+#include "instrumentation.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <utility>
+
+
+template <typename Engine>
+BasicShoe<Engine>::BasicShoe(int deckCount, int cutCard)
+    : BasicShoe(deckCount, cutCard, seedFromDevice())
+{
+}
+
+/**
+ * Builds a shoe of `deckCount` ordered decks.
+ *
+ * @param deckCount number of 52 card decks in the shoe
+ * @param cutCard number of cards dealt before the shoe is reshuffled, 0 for
+ *      the usual 75% penetration
+ * @param seed seed of the engine driving the shuffle
+ */
+template <typename Engine>
+BasicShoe<Engine>::BasicShoe(int deckCount, int cutCard, std::uint64_t seed)
+    : m_cutCard{ cutCard }, m_deckCount{ deckCount }, m_engine(seed)
+{
+    assert(deckCount > 0 && "a shoe needs at least one deck");
+    
+    m_shoe.reserve(deckCount * Global::cardsInADeck);
+    for(int d{0}; d < deckCount; d++)
+        m_shoe.insert(m_shoe.end(), cards::orderedDeck.begin(), cards::orderedDeck.end());
+    
+    if (m_cutCard <= 0 or m_cutCard > size())
+        m_cutCard = size() * 3 / 4;
+}
+
+template <typename Engine>
+void BasicShoe<Engine>::print()
+{
+    std::string text(formattedSize(), '\0');
+    std::cout.write(text.data(), format(&text[0]) - text.data());
+}
+
+/**
+ * Writes the shoe in its current order at `out`, the same text `print()`
+ * shows, and returns the position after it. `out` needs room for
+ * `formattedSize()` characters.
+ */
+template <typename Engine>
+char *BasicShoe<Engine>::format(char *out) const
+{
+    out = formatCards(out, m_shoe.data(), m_shoe.data() + m_shoe.size());
+    *out++ = '\n';
+    *out++ = '\n';
+    return out;
+}
+
+template <typename Engine>
+std::size_t BasicShoe<Engine>::formattedSize() const
+{
+    return m_shoe.size() * (Card::textSize + 1) + 2;
+}
+
+/**
+ * Puts every card back in the shoe. No card is moved here, the actual
+ * shuffling happens one card at a time in `dealCard()`.
+ */
+template <typename Engine>
+void BasicShoe<Engine>::shuffle()
+{
+    INSTRUMENT_COUNT(shuffles, 1);
+    m_cardIndex = 0;
+}
+
+/**
+ * Deals the next card, reshuffling first once the cut card has been reached
+ */
+template <typename Engine>
+const Card &BasicShoe<Engine>::dealCard()
+{
+    if (m_cardIndex >= m_cutCard)
+    {
+        INSTRUMENT_COUNT(reshuffles, 1);
+        shuffle();
+    }
+    INSTRUMENT_COUNT(cards_dealt, 1);
+    
+    // One Fisher-Yates step: pick any undealt card and move it into place
+    auto undealt{ static_cast<std::uint32_t>(size() - m_cardIndex) };
+    int pick{ m_cardIndex + static_cast<int>(boundedRandom(m_engine, undealt)) };
+    std::swap(m_shoe[m_cardIndex], m_shoe[pick]);
+    
+    return m_shoe[ m_cardIndex++ ];
+}
+
+/**
+ * Deals the next `count` cards at once, the same cards `count` calls to
+ * `dealCard()` would give.
+ *
+ * When the cut card is not reached inside the batch, the Fisher-Yates steps
+ * run back to back and the cards are handed out in place. Otherwise they
+ * are dealt one by one into a staging buffer, which the span then points to.
+ */
+template <typename Engine>
+CardSpan BasicShoe<Engine>::deal(int count)
+{
+    assert(count >= 0 && count <= maxDeal && "batch larger than a deck");
+    
+    if (m_cardIndex + count > m_cutCard)
+    {
+        for (int i{0}; i < count; i++)
+            m_staging[i] = dealCard();
+        return { m_staging, m_staging + count };
+    }
+    
+    int first{ m_cardIndex };
+    auto undealt{ static_cast<std::uint32_t>(size() - m_cardIndex) };
+    for (int i{0}; i < count; i++, undealt--)
+    {
+        int pick{ m_cardIndex + static_cast<int>(boundedRandom(m_engine, undealt)) };
+        std::swap(m_shoe[m_cardIndex], m_shoe[pick]);
+        m_cardIndex++;
+    }
+    INSTRUMENT_COUNT(cards_dealt, count);
+    return { m_shoe.data() + first, m_shoe.data() + m_cardIndex };
+}
+
+template <typename Engine>
+int BasicShoe<Engine>::getIndex() const
+{
+    return m_cardIndex;
+}
+
+template <typename Engine>
+int BasicShoe<Engine>::getCutCard() const
+{
+    return m_cutCard;
+}
+
+template <typename Engine>
+int BasicShoe<Engine>::getDeckCount() const
+{
+    return m_deckCount;
+}
+
+template <typename Engine>
+int BasicShoe<Engine>::size() const
+{
+    return static_cast<int>(m_shoe.size());
+}
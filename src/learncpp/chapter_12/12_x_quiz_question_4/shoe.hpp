@@ -0,0 +1,66 @@
+//
+//  shoe.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef shoe_hpp
+#define shoe_hpp
+
+#include "globals.cpp"
+#include "card.hpp"
+#include "random_engines.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * A multi-deck shoe with a penetration cut card.
+ *
+ * The shoe is shuffled lazily: `shuffle()` only rewinds the deal position and
+ * every `dealCard()` performs one Fisher-Yates step, swapping a random card
+ * from the undealt part into place. A reshuffle therefore costs O(1) instead
+ * of O(shoe size), and the cards dealt are still a uniform random sequence.
+ */
+template <typename Engine>
+class BasicShoe
+{
+private:
+    int m_cardIndex{ 0 };
+    int m_cutCard{ 0 };
+    int m_deckCount{ 0 };
+    std::vector<Card> m_shoe;
+    Card m_staging[ Global::cardsInADeck ];
+    Engine m_engine;
+    
+public:
+    // Most cards a single `deal()` hands out
+    static constexpr int maxDeal{ Global::cardsInADeck };
+    
+    explicit BasicShoe(int deckCount = 6, int cutCard = 0);
+    BasicShoe(int deckCount, int cutCard, std::uint64_t seed);
+    void print();
+    char *format(char *out) const;
+    std::size_t formattedSize() const;
+    void shuffle();
+    const Card &dealCard();
+    CardSpan deal(int count);
+    int getIndex() const;
+    int getCutCard() const;
+    int getDeckCount() const;
+    int size() const;
+    
+    // The cards not dealt yet, e.g. for `ShoeComposition::fromCards()`
+    const Card *undealtBegin() const { return m_shoe.data() + m_cardIndex; }
+    const Card *undealtEnd() const { return m_shoe.data() + m_shoe.size(); }
+    
+};
+
+using Shoe = BasicShoe<Pcg32>;
+
+
+#endif /* shoe_hpp */
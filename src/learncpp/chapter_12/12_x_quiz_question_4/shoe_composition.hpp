@@ -0,0 +1,173 @@
+//
+//  shoe_composition.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef shoe_composition_hpp
+#define shoe_composition_hpp
+
+#include "globals.cpp"
+#include "card.hpp"
+#include "basic_strategy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * How many cards of each value class (see `cardClasses`) are left in a shoe.
+ *
+ * The counts pack into one 64 bit code: 6 bits for each of the nine classes
+ * holding 4 cards per deck and 8 bits for the tens, in 62 bits. A 6 bit
+ * count holds at most 63 cards and an 8 bit one 255, so the code covers up
+ * to 15 decks (60 and 240 cards). Equal compositions always give equal codes,
+ * which makes the code a ready made hash key.
+ */
+class ShoeComposition
+{
+private:
+    std::array<int, cardClasses> m_counts{};
+    int m_total{ 0 };
+
+    static constexpr int tenClass{ 10 - 2 };
+    static constexpr int smallBits{ 6 };
+    static constexpr int tenBits{ 8 };
+    static constexpr int maxSmallCount{ (1 << smallBits) - 1 };
+    static constexpr int maxTenCount{ (1 << tenBits) - 1 };
+
+public:
+    static constexpr int maxDecks{ std::min(maxSmallCount / 4, maxTenCount / 16) };
+
+    ShoeComposition() = default;
+
+    /**
+     * Returns the composition of `decks` full decks
+     */
+    static ShoeComposition fullShoe(int decks)
+    {
+        assert(decks > 0 && decks <= maxDecks && "composition codes cover up to maxDecks decks");
+
+        ShoeComposition composition{};
+        for (int c{0}; c < cardClasses; c++)
+            composition.m_counts[c] = (c == tenClass ? 16 : 4) * decks;
+        composition.m_total = Global::cardsInADeck * decks;
+        return composition;
+    }
+
+    /**
+     * Returns the composition of the cards in [first, last)
+     */
+    static ShoeComposition fromCards(const Card *first, const Card *last)
+    {
+        ShoeComposition composition{};
+        for (; first != last; ++first)
+            composition.add(first->value() - 2);
+        return composition;
+    }
+
+    int count(int cardClass) const { return m_counts[cardClass]; }
+    int total() const { return m_total; }
+
+    double probability(int cardClass) const
+    {
+        return static_cast<double>(m_counts[cardClass]) / m_total;
+    }
+
+    void add(int cardClass)
+    {
+        assert(m_counts[cardClass] < (cardClass == tenClass ? maxTenCount : maxSmallCount) &&
+               "too many cards of this class for the composition code");
+        ++m_counts[cardClass];
+        ++m_total;
+    }
+
+    void remove(int cardClass)
+    {
+        assert(m_counts[cardClass] > 0 && "no card of this class left");
+        --m_counts[cardClass];
+        --m_total;
+    }
+
+    ShoeComposition without(int cardClass) const
+    {
+        ShoeComposition composition{ *this };
+        composition.remove(cardClass);
+        return composition;
+    }
+
+    /**
+     * Returns the 62 bit code of the composition
+     */
+    std::uint64_t code() const
+    {
+        std::uint64_t code{ 0 };
+        int shift{ 0 };
+        for (int c{0}; c < cardClasses; c++)
+        {
+            code |= static_cast<std::uint64_t>(m_counts[c]) << shift;
+            shift += (c == tenClass ? tenBits : smallBits);
+        }
+        return code;
+    }
+
+    /**
+     * Rebuilds a composition from its code
+     */
+    static ShoeComposition fromCode(std::uint64_t code)
+    {
+        ShoeComposition composition{};
+        for (int c{0}; c < cardClasses; c++)
+        {
+            int bits{ c == tenClass ? tenBits : smallBits };
+            composition.m_counts[c] = static_cast<int>(code & ((std::uint64_t{ 1 } << bits) - 1));
+            composition.m_total += composition.m_counts[c];
+            code >>= bits;
+        }
+        return composition;
+    }
+
+    /**
+     * Returns the probability of drawing each class, to feed the strategy
+     * generator with this composition instead of full decks
+     */
+    CardWeights weights() const
+    {
+        CardWeights weights{};
+        for (int c{0}; c < cardClasses; c++)
+            weights[c] = probability(c);
+        return weights;
+    }
+};
+
+
+/**
+ * Hash key for anything cached per shoe composition: the composition code
+ * plus a small caller defined state (a hand, a hand and an upcard, ...).
+ */
+struct CompositionKey
+{
+    std::uint64_t composition{};
+    std::uint16_t state{};
+
+    bool operator==(const CompositionKey &other) const
+    {
+        return composition == other.composition and state == other.state;
+    }
+};
+
+struct CompositionKeyHash
+{
+    std::size_t operator()(const CompositionKey &key) const
+    {
+        std::uint64_t h{ key.composition * 0x9E3779B97F4A7C15ULL ^ key.state };
+        return static_cast<std::size_t>(h ^ (h >> 29));
+    }
+};
+
+#endif /* shoe_composition_hpp */
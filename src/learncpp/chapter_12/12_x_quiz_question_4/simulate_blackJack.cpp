@@ -0,0 +1,83 @@
+//
+//  simulate_blackJack.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "shoe.cpp"
+#include "player.cpp"
+#include "simulation.hpp"
+#include "strategy_names.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+
+/**
+ * Prints the totals of a simulation run and the hands per second reached.
+ *
+ * @param result the totals of the run
+ * @param seconds wall clock time the run took
+ */
+void printSimulationResult(const SimulationResult &result, double seconds)
+{
+    auto percent = [&result](long long count)
+    {
+        return result.hands ? 100.0 * count / result.hands : 0.0;
+    };
+
+    std::cout << "[INFO] - Hands played   = " << result.hands << "\n";
+    std::cout << "[INFO] - Player wins    = " << result.playerWins << " (" << percent(result.playerWins) << "%)\n";
+    std::cout << "[INFO] - Dealer wins    = " << result.dealerWins << " (" << percent(result.dealerWins) << "%)\n";
+    std::cout << "[INFO] - Ties           = " << result.ties << " (" << percent(result.ties) << "%)\n";
+    std::cout << "[INFO] - Player busts   = " << result.playerBusts << "\n";
+    std::cout << "[INFO] - Dealer busts   = " << result.dealerBusts << "\n";
+    std::cout << "[INFO] - Hands / second = " << static_cast<long long>(result.hands / seconds) << "\n";
+}
+
+/**
+ * Plays `hands` hands with `strategy`, from a single deck like the
+ * interactive game or from a shoe when more decks are asked for.
+ */
+template <typename Strategy>
+SimulationResult runSimulation(Strategy strategy, long long hands, int decks, int cutCard)
+{
+    if (decks > 1)
+    {
+        Shoe shoe{ decks, cutCard };
+        return simulate(shoe, strategy, hands);
+    }
+
+    Deck deck{};
+    deck.shuffle();
+    return simulate(deck, strategy, hands);
+}
+
+// Usage: simulate_blackJack [hands] [hit below | basic] [decks] [cut card]
+int main(int argc, char *argv[])
+{
+    long long hands{ argc > 1 ? std::atoll(argv[1]) : 1000000 };
+    std::string strategy{ argc > 2 ? argv[2] : "basic" };
+    int decks{ argc > 3 ? std::atoi(argv[3]) : 1 };
+    int cutCard{ argc > 4 ? std::atoi(argv[4]) : 0 };
+
+    SimulationResult result{};
+    auto start{ std::chrono::steady_clock::now() };
+
+    if (not withStrategy(strategy, [&](auto visited) { result = runSimulation(visited, hands, decks, cutCard); }))
+    {
+        std::cout << "[ERROR] - Usage: simulate_blackJack [hands] [hit below | basic] [decks] [cut card]\n";
+        return 1;
+    }
+
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    printSimulationResult(result, elapsed.count());
+    return 0;
+}
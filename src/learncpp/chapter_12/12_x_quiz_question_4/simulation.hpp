@@ -0,0 +1,274 @@
+//
+//  simulation.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef simulation_hpp
+#define simulation_hpp
+
+#include "globals.cpp"
+#include "deck.hpp"
+#include "shoe.hpp"
+#include "player.hpp"
+#include "rules.hpp"
+#include "instrumentation.hpp"
+
+#include <cstdint>
+
+
+/**
+ * Totals collected over a run of headless hands.
+ */
+struct SimulationResult
+{
+    long long hands{ 0 };
+    long long playerWins{ 0 };
+    long long dealerWins{ 0 };
+    long long ties{ 0 };
+    long long playerBusts{ 0 };
+    long long dealerBusts{ 0 };
+    long long blackJacks{ 0 };      // winning two card 21s
+    long long surrenders{ 0 };      // counted in `dealerWins` as well
+    double playerUnits{ 0.0 };      // net bets won by the player
+
+    SimulationResult &operator+=(const SimulationResult &other)
+    {
+        hands += other.hands;
+        playerWins += other.playerWins;
+        dealerWins += other.dealerWins;
+        ties += other.ties;
+        playerBusts += other.playerBusts;
+        dealerBusts += other.dealerBusts;
+        blackJacks += other.blackJacks;
+        surrenders += other.surrenders;
+        playerUnits += other.playerUnits;
+        return *this;
+    }
+
+    double expectedValue() const
+    {
+        return hands ? playerUnits / hands : 0.0;
+    }
+
+    // True if every total is exactly the same, as runs of the same hands give
+    bool operator==(const SimulationResult &other) const
+    {
+        return hands == other.hands and playerWins == other.playerWins and
+               dealerWins == other.dealerWins and ties == other.ties and
+               playerBusts == other.playerBusts and dealerBusts == other.dealerBusts and
+               blackJacks == other.blackJacks and surrenders == other.surrenders and
+               playerUnits == other.playerUnits;
+    }
+
+    bool operator!=(const SimulationResult &other) const
+    {
+        return not (*this == other);
+    }
+};
+
+
+/**
+ * Decision policy that keeps hitting while the player's score is below a
+ * fixed threshold. With the default threshold it mirrors the dealer's rule.
+ */
+class HitBelowStrategy
+{
+private:
+    int m_threshold{ Global::maxDealerValue };
+
+public:
+    HitBelowStrategy() = default;
+
+    explicit HitBelowStrategy(int threshold)
+        : m_threshold{ threshold }
+    {
+    }
+
+    bool operator()(int playerScore, bool /*isSoft*/, int /*dealerUpcard*/) const
+    {
+        return playerScore < m_threshold;
+    }
+};
+
+
+/**
+ * Hand observer that ignores every event. It is the default of `playHand()`,
+ * so a run that records nothing pays nothing for the hooks.
+ */
+struct NullObserver
+{
+    void deckSeeded(std::uint64_t /*seed*/) {}
+    void beginHand() {}
+    void cardDealt(int /*seat*/, const Card & /*card*/) {}
+    void decision(bool /*hit*/) {}
+    void surrendered() {}
+    void endHand(BlackJackResult /*result*/) {}
+};
+
+
+// Seats reported to hand observers
+constexpr int playerSeat{ 0 };
+constexpr int dealerSeat{ 1 };
+
+
+/**
+ * Plays one hand without any console I/O and records it in `result`.
+ *
+ * A strategy is any callable `bool(int playerScore, bool isSoft,
+ * int dealerUpcard)` returning true to hit, and takes the place of
+ * `getUserResponse()`. The dealer's first card is dealt before the player
+ * decides so that the strategy can look at the upcard. Under rules with
+ * late surrender, a strategy with a `surrender()` member (see
+ * `wantsSurrender()`) is asked first at the player's first two card
+ * decision.
+ *
+ * The observer is told about every card dealt, every hit/stay decision
+ * taken by the strategy and the result of the hand, in the order they
+ * happen (see `NullObserver` for the hooks).
+ *
+ * @tparam Rules the table rules, `ClassicRules` unless given explicitly
+ * @param deck the deck or shoe the hand is dealt from
+ * @param strategy the player's hit/stay policy
+ * @param result the totals to update
+ * @param observer receives the events of the hand
+ */
+template <typename Rules = ClassicRules, typename CardSource, typename Strategy, typename Observer>
+BlackJackResult playHand(CardSource &deck, Strategy &strategy, SimulationResult &result, Observer &observer)
+{
+    Player player{};
+    Player dealer{};
+    int playerCards{ 1 };
+
+    auto deal = [&deck, &observer](Player &to, int seat)
+    {
+        Card card{ deck.dealCard() };
+        observer.cardDealt(seat, card);
+        return to.addCard(card);
+    };
+
+    auto finish = [&observer](BlackJackResult outcome)
+    {
+        observer.endHand(outcome);
+        return outcome;
+    };
+
+    // The first card of both seats comes in one batch
+    observer.beginHand();
+    INSTRUMENT_TIME_SAMPLED(hand_latency, hands, instrument::handSampleEvery);
+    INSTRUMENT_COUNT(hands, 1);
+    CardSpan initial{ deck.deal(2) };
+    observer.cardDealt(playerSeat, initial[0]);
+    observer.cardDealt(dealerSeat, initial[1]);
+    player.addCard(initial[0]);
+    int dealerUpcard{ dealer.addCard(initial[1]) };
+
+    ++result.hands;
+
+    // Player hits until the strategy says stay or `blackJack` is reached
+    while (player.score() < Rules::blackJack)
+    {
+        if constexpr (Rules::lateSurrender)
+        {
+            if (playerCards == 2 and wantsSurrender(strategy, player.score(), player.isSoft(), dealerUpcard))
+            {
+                observer.surrendered();
+                ++result.surrenders;
+                ++result.dealerWins;
+                result.playerUnits -= 0.5;
+                return finish(BlackJackResult::dealer_won);
+            }
+        }
+
+        bool hit{ strategy(player.score(), player.isSoft(), dealerUpcard) };
+        observer.decision(hit);
+        if (not hit)
+            break;
+        deal(player, playerSeat);
+        ++playerCards;
+    }
+
+    if (player.isBust())
+    {
+        ++result.playerBusts;
+        INSTRUMENT_COUNT(player_busts, 1);
+        ++result.dealerWins;
+        result.playerUnits -= 1.0;
+        return finish(BlackJackResult::dealer_won);
+    }
+
+    // Dealer hits until the rules say stand, or bust
+    while (not Rules::dealerStands(dealer.score(), dealer.isSoft()))
+        deal(dealer, dealerSeat);
+
+    int playerValue{ player.score() };
+    int dealerValue{ dealer.score() };
+
+    // A two card 21 wins the same hands as any 21 but may pay a bonus
+    auto playerWins = [&result, playerValue, playerCards]()
+    {
+        ++result.playerWins;
+        if (playerCards == 2 and playerValue == Rules::blackJack)
+        {
+            ++result.blackJacks;
+            result.playerUnits += Rules::blackJackPayout;
+        }
+        else
+            result.playerUnits += 1.0;
+    };
+
+    if (dealerValue > Rules::blackJack)
+    {
+        ++result.dealerBusts;
+        INSTRUMENT_COUNT(dealer_busts, 1);
+        playerWins();
+        return finish(BlackJackResult::player_won);
+    }
+    else if (playerValue > dealerValue)
+    {
+        playerWins();
+        return finish(BlackJackResult::player_won);
+    }
+    else if (playerValue < dealerValue)
+    {
+        ++result.dealerWins;
+        result.playerUnits -= 1.0;
+        return finish(BlackJackResult::dealer_won);
+    }
+
+    ++result.ties;
+    return finish(BlackJackResult::tie);
+}
+
+
+template <typename Rules = ClassicRules, typename CardSource, typename Strategy>
+BlackJackResult playHand(CardSource &deck, Strategy &strategy, SimulationResult &result)
+{
+    NullObserver observer{};
+    return playHand<Rules>(deck, strategy, result, observer);
+}
+
+
+/**
+ * Plays `hands` hands back to back from `deck` and returns the totals.
+ *
+ * @tparam Rules the table rules, `ClassicRules` unless given explicitly
+ * @param deck the deck or shoe the hands are dealt from
+ * @param strategy the player's hit/stay policy
+ * @param hands number of hands to play
+ * @param observer receives the events of every hand
+ */
+template <typename Rules = ClassicRules, typename CardSource, typename Strategy, typename Observer = NullObserver>
+SimulationResult simulate(CardSource &deck, Strategy strategy, long long hands, Observer &&observer = {})
+{
+    SimulationResult result{};
+
+    for (long long i{0}; i < hands; i++)
+        playHand<Rules>(deck, strategy, result, observer);
+
+    return result;
+}
+
+#endif /* simulation_hpp */
@@ -0,0 +1,55 @@
+//
+//  stats_blackJack.cpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "globals.cpp"
+#include "deck.cpp"
+#include "player.cpp"
+#include "parallel_simulation.hpp"
+#include "instrumentation.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+
+// Usage: stats_blackJack [hands] [threads] [interval ms] [--json]
+//
+// Runs a parallel simulation and prints the engine's counters and latency
+// histograms every interval while it runs. Needs -DBLACKJACK_INSTRUMENT.
+int main(int argc, char *argv[])
+{
+    bool json{ false };
+    if (argc > 1 and std::strcmp(argv[argc - 1], "--json") == 0)
+    {
+        json = true;
+        --argc;
+    }
+
+    long long hands{ argc > 1 ? std::atoll(argv[1]) : 50000000 };
+    int threads{ argc > 2 ? std::atoi(argv[2]) : 0 };
+    long interval{ argc > 3 ? std::atol(argv[3]) : 500 };
+
+    if (not instrument::enabled)
+    {
+        std::cout << "[ERROR] - Built without instrumentation, rebuild with -DBLACKJACK_INSTRUMENT\n";
+        return 1;
+    }
+
+    SimulationResult result{};
+    {
+        instrument::SnapshotReporter reporter{ std::cout, std::chrono::milliseconds{ interval }, json };
+        result = simulateParallel(HitBelowStrategy{}, hands, 2022, threads);
+    }
+
+    if (not json)
+        std::cout << "[INFO] - Player wins = " << result.playerWins
+                  << ", dealer wins = " << result.dealerWins
+                  << ", ties = " << result.ties << "\n";
+    return 0;
+}
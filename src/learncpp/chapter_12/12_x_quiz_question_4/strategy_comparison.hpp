@@ -0,0 +1,188 @@
+//
+//  strategy_comparison.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef strategy_comparison_hpp
+#define strategy_comparison_hpp
+
+#include "globals.cpp"
+#include "card.hpp"
+#include "rules.hpp"
+#include "simulation.hpp"
+#include "running_stats.hpp"
+
+
+/**
+ * Returns `card` with its rank turned upside down: two and ace swap, three
+ * and king, and so on, with the eight staying put. Applied to every card of
+ * a uniformly shuffled deck it gives another uniformly shuffled deck, one
+ * rich in low cards wherever the original was rich in high ones.
+ */
+constexpr Card mirroredCard(const Card &card)
+{
+    return { static_cast<Card::Rank>(Card::max_rank - 1 - card.rank()), card.suit() };
+}
+
+/**
+ * Card source dealing the mirror image (see `mirroredCard()`) of the cards
+ * `source` deals. Used for the antithetic half of a comparison trial.
+ */
+template <typename CardSource>
+class MirroredCards
+{
+private:
+    CardSource &m_source;
+    Card m_card{};
+    Card m_batch[ CardSource::maxDeal ];
+
+public:
+    static constexpr int maxDeal{ CardSource::maxDeal };
+
+    explicit MirroredCards(CardSource &source)
+        : m_source{ source }
+    {
+    }
+
+    const Card &dealCard()
+    {
+        m_card = mirroredCard(m_source.dealCard());
+        return m_card;
+    }
+
+    CardSpan deal(int count)
+    {
+        CardSpan cards{ m_source.deal(count) };
+        for (int i{0}; i < count; i++)
+            m_batch[i] = mirroredCard(cards[i]);
+        return { m_batch, m_batch + count };
+    }
+};
+
+
+/**
+ * When a comparison stops and how it samples.
+ */
+struct ComparisonOptions
+{
+    double targetHalfWidth{ 0.002 };        // of the EV difference, in bets per hand
+    double z{ 1.96 };                       // 95% confidence
+    bool antithetic{ false };               // also play every trial mirrored
+    long long minTrials{ 10000 };
+    long long maxTrials{ 100000000 };
+    long long checkEvery{ 10000 };          // trials between interval checks
+};
+
+/**
+ * What a comparison measured. A trial is one hand per strategy, or two with
+ * antithetic sampling, and `difference` has one sample per trial.
+ */
+struct ComparisonResult
+{
+    RunningStats difference;        // EV of the first strategy minus the second
+    RunningStats first;             // units won per hand by the first strategy
+    RunningStats second;            // units won per hand by the second strategy
+    SimulationResult firstTotals;
+    SimulationResult secondTotals;
+    bool converged{ false };
+
+    long long trials() const { return difference.count(); }
+
+    /**
+     * Hands each strategy would need in two independent runs to get the same
+     * interval on the difference: the variance of a difference of
+     * independent means is the sum of the two variances.
+     */
+    double independentHands(double halfWidth, double z = 1.96) const
+    {
+        double width{ halfWidth / z };
+        return (first.variance() + second.variance()) / (width * width);
+    }
+};
+
+
+/**
+ * Plays `first` and `second` against each other on common random numbers
+ * until the confidence interval on their EV difference is narrower than
+ * `options.targetHalfWidth`.
+ *
+ * Every trial shuffles `source` afresh and lets both strategies play one hand
+ * from a copy of it, so both see exactly the same cards until their
+ * decisions differ. Whatever the two strategies do alike cancels out of the
+ * difference, which has a far smaller variance than that of two independent
+ * runs. With `options.antithetic` each trial is played a second time from
+ * the mirrored cards and the two differences are averaged.
+ *
+ * Since every hand comes off a fresh shuffle, the EVs are those of the first
+ * hand of a deck rather than of a long run through one.
+ *
+ * @tparam Rules the table rules, `ClassicRules` unless given explicitly
+ * @param source the deck or shoe the trials are shuffled from
+ * @param first the first strategy
+ * @param second the second strategy
+ * @param options when to stop and how to sample
+ */
+template <typename Rules = ClassicRules, typename CardSource, typename FirstStrategy, typename SecondStrategy>
+ComparisonResult compareStrategies(CardSource &source, FirstStrategy first, SecondStrategy second,
+                                   const ComparisonOptions &options = {})
+{
+    ComparisonResult result{};
+    CardSource played{ source };
+    CardSource replayed{ source };
+
+    // Units won by `strategy` on one hand from `from`
+    auto playOne = [](auto &from, auto &strategy, SimulationResult &totals)
+    {
+        double before{ totals.playerUnits };
+        playHand<Rules>(from, strategy, totals);
+        return totals.playerUnits - before;
+    };
+
+    while (result.trials() < options.maxTrials)
+    {
+        source.shuffle();
+
+        played = source;
+        double firstUnits{ playOne(played, first, result.firstTotals) };
+        replayed = source;
+        double secondUnits{ playOne(replayed, second, result.secondTotals) };
+
+        result.first.add(firstUnits);
+        result.second.add(secondUnits);
+        double difference{ firstUnits - secondUnits };
+
+        if (options.antithetic)
+        {
+            MirroredCards<CardSource> mirrored{ replayed };
+
+            replayed = source;
+            double firstMirrored{ playOne(mirrored, first, result.firstTotals) };
+            replayed = source;
+            double secondMirrored{ playOne(mirrored, second, result.secondTotals) };
+
+            result.first.add(firstMirrored);
+            result.second.add(secondMirrored);
+            difference = (difference + firstMirrored - secondMirrored) / 2;
+        }
+
+        // Go on from the engine state the first hand left, as a shoe only
+        // draws its random numbers while dealing
+        source = played;
+        result.difference.add(difference);
+
+        long long trials{ result.trials() };
+        if (trials >= options.minTrials and trials % options.checkEvery == 0 and
+            result.difference.halfWidth(options.z) < options.targetHalfWidth)
+        {
+            result.converged = true;
+            break;
+        }
+    }
+
+    return result;
+}
+
+#endif /* strategy_comparison_hpp */
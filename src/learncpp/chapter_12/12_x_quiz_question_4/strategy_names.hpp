@@ -0,0 +1,47 @@
+//
+//  strategy_names.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef strategy_names_hpp
+#define strategy_names_hpp
+
+#include "simulation.hpp"
+#include "strategy_table.hpp"
+#include "basic_strategy_table.hpp"
+
+#include <string>
+
+
+/**
+ * Returns true if `name` stands for a strategy: "basic" for the generated
+ * basic strategy, or a number of at most two digits to hit below.
+ */
+inline bool isStrategyName(const std::string &name)
+{
+    if (name == "basic")
+        return true;
+    return not name.empty() and name.size() <= 2 and name.find_first_not_of("0123456789") == std::string::npos;
+}
+
+/**
+ * Calls `visit` with the strategy `name` stands for (see `isStrategyName()`).
+ * Returns false, without calling it, if `name` is no strategy.
+ */
+template <typename Visitor>
+bool withStrategy(const std::string &name, Visitor &&visit)
+{
+    if (not isStrategyName(name))
+        return false;
+
+    if (name == "basic")
+        visit(TableStrategy{ basicStrategyTable });
+    else
+        visit(HitBelowStrategy{ std::stoi(name) });
+    return true;
+}
+
+#endif /* strategy_names_hpp */
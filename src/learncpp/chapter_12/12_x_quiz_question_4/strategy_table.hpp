@@ -0,0 +1,70 @@
+//
+//  strategy_table.hpp
+//  learncpp
+//
+//  Created by Allwyn Joseph on 18/10/2026.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#ifndef strategy_table_hpp
+#define strategy_table_hpp
+
+#include "globals.cpp"
+
+#include <array>
+#include <cstdint>
+
+
+/**
+ * Hit/stand decisions for every player total and dealer upcard.
+ *
+ * Each row is one player total (hard or soft) and bit `upcard` of the row is
+ * set when the player should hit against that upcard (2 to 11, an ace being
+ * 11). A lookup is one load, one shift and one mask. The `surrender` rows
+ * mark the hard totals worth giving up half the bet on, for rules that allow
+ * late surrender.
+ */
+struct StrategyTable
+{
+    std::array<std::uint16_t, Global::blackJack + 1> hard{};
+    std::array<std::uint16_t, Global::blackJack + 1> soft{};
+    std::array<std::uint16_t, Global::blackJack + 1> surrender{};
+
+    constexpr bool shouldHit(int playerScore, bool isSoft, int dealerUpcard) const
+    {
+        return ((isSoft ? soft[playerScore] : hard[playerScore]) >> dealerUpcard) & 1;
+    }
+
+    constexpr bool shouldSurrender(int playerScore, bool isSoft, int dealerUpcard) const
+    {
+        return not isSoft and ((surrender[playerScore] >> dealerUpcard) & 1);
+    }
+};
+
+
+/**
+ * Decision policy for the simulation engine backed by a `StrategyTable`.
+ */
+class TableStrategy
+{
+private:
+    const StrategyTable *m_table{ nullptr };
+
+public:
+    explicit TableStrategy(const StrategyTable &table)
+        : m_table{ &table }
+    {
+    }
+
+    bool operator()(int playerScore, bool isSoft, int dealerUpcard) const
+    {
+        return m_table->shouldHit(playerScore, isSoft, dealerUpcard);
+    }
+
+    bool surrender(int playerScore, bool isSoft, int dealerUpcard) const
+    {
+        return m_table->shouldSurrender(playerScore, isSoft, dealerUpcard);
+    }
+};
+
+#endif /* strategy_table_hpp */
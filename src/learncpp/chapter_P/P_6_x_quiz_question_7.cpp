@@ -13,6 +13,10 @@
 #include <array>
 #include <random>
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
 
 
 using namespace std;
@@ -32,9 +36,7 @@ enum class BlackJackResult
  */
 void printCard(const Card &card)
 {
-    char rank{getCardRank(card.rank)};
-    char suit{getCardSuit(card.suit)};
-    cout << rank << suit << "\n";
+    cout << card.rankSymbol() << card.suitSymbol() << "\n";
 }
 
 /**
@@ -49,53 +51,44 @@ void printDeck(const Card deck[], int size = 52)
 }
 
 /**
- * Shuffles cards in the deck
+ * Shuffles the cards of the game's deck with the game's own engine and
+ * starts dealing from the top again.
  *
- * @param deck a struct containing card rank and suit
- */
-void shuffleDeck(Card deck[], int size = 52)
-{
-    random_device rd;
-    mt19937 g(rd());
-    shuffle(deck, deck + size, g);
-}
-
-/**
- * Displays player's and dealer's total card value
- *
- * @param playerValue an int indicating player's card value
- * @param dealerValue an int indicating dealer's card value
+ * @param game the state of the game whose deck is shuffled
  */
-void printDealerAndPlayerValue(int playerValue, int dealerValue)
+void shuffleDeck(GameState &game)
 {
-    cout << "\n\n[INFO] - Player's total card value = " << playerValue;
-    cout << "\n[INFO] - Dealer's total card value = " << dealerValue;
+    shuffle(game.deck.begin(), game.deck.end(), game.engine);
+    game.deck_index = 0;
 }
 
 /**
  * Returns the result of the game played
  *
- * @param deck an array of structs, with each struct containing a card rank and
- *      card suit objects
+ * @param game the state of the game: its deck, deck index, engine and how
+ *      the player decides to hit
+ * @param sink receives the events of the game, `ConsoleSink` to show them
+ *      or `NullSink` to play silently
  */
-BlackJackResult playBlackJack(Card deck[])
+template <typename Sink>
+BlackJackResult playBlackJack(GameState &game, Sink &sink)
 {
     // Player plays until bust or satisfcation
-    cout << "\n\n[INFO] - It's the player's chance to play first.";
-    int playerValue{ play(deck) };
+    sink.playerTurn();
+    int playerValue{ play(game, sink) };
     
     // Check if player's total card value exceeds blackjack
     if (playerValue > blackJack)
     {
-        printDealerAndPlayerValue(playerValue, 0);
+        sink.valuesCompared(playerValue, 0);
         return BlackJackResult::dealer_won;
     }
     
     // Dealer plays until at least 17 or bust
-    cout << "\n\n[INFO] - The dealer will now play until 17 or bust.";
-    int dealerValue{ play(deck, true) };
+    sink.dealerTurn();
+    int dealerValue{ play(game, sink, true) };
     
-    printDealerAndPlayerValue(playerValue, dealerValue);
+    sink.valuesCompared(playerValue, dealerValue);
     
     // If delar's card value is greater than 21 or player's card value greater
     // the dealer's, player wins (cause player's card value < 21)
@@ -109,16 +102,79 @@ BlackJackResult playBlackJack(Card deck[])
         return BlackJackResult::tie;
 }
 
-int main()
-{    
+/**
+ * Plays `games` silent games, each on a freshly shuffled deck of its own
+ * game state, spread over `threads` threads, and prints how fast they went.
+ *
+ * @param games number of games to play
+ * @param threads number of threads playing at the same time
+ */
+void playManyGames(long long games, int threads)
+{
+    vector<long long> wins(threads), ties(threads);
+    vector<thread> workers;
+    
+    auto start{ chrono::steady_clock::now() };
+    for (int t{0}; t < threads; t++)
+    {
+        workers.emplace_back([t, threads, games, &wins, &ties]()
+        {
+            GameState game{ static_cast<mt19937::result_type>(t + 1) };
+            game.wantsHit = hitBelowSeventeen;
+            NullSink sink{};
+            
+            // Counts stay in locals until the end: neighbouring elements of
+            // wins and ties share a cache line, which every thread would
+            // otherwise be writing to after each game
+            long long myWins{ 0 }, myTies{ 0 };
+            for (long long g{ t }; g < games; g += threads)
+            {
+                shuffleDeck(game);
+                BlackJackResult result{ playBlackJack(game, sink) };
+                if (result == BlackJackResult::player_won)
+                    ++myWins;
+                else if (result == BlackJackResult::tie)
+                    ++myTies;
+            }
+            wins[t] = myWins;
+            ties[t] = myTies;
+        });
+    }
+    for (auto &worker : workers)
+        worker.join();
+    chrono::duration<double> elapsed{ chrono::steady_clock::now() - start };
+    
+    long long totalWins{ 0 }, totalTies{ 0 };
+    for (int t{0}; t < threads; t++)
+    {
+        totalWins += wins[t];
+        totalTies += ties[t];
+    }
+    
+    cout << "[INFO] - Games played      = " << games << " on " << threads << " threads\n";
+    cout << "[INFO] - Player wins/ties  = " << totalWins << " / " << totalTies << "\n";
+    cout << "[INFO] - Games / second    = " << static_cast<long long>(games / elapsed.count()) << "\n";
+}
+
+// Usage: P_6_x_quiz_question_7 [games to play silently] [threads]
+int main(int argc, char *argv[])
+{
+    if (argc > 1)
+    {
+        int threads{ argc > 2 ? atoi(argv[2]) : static_cast<int>(max(1u, thread::hardware_concurrency())) };
+        playManyGames(atoll(argv[1]), max(1, threads));
+        return 0;
+    }
+    
     cout << "\n[INFO] - Beginning a game of BlackJack";
     // Create and shuffle deck of cards
-    auto deck{ createDeck() };
+    GameState game{};
     cout << "\n[INFO] - Shuffling deck ..";
-    shuffleDeck(deck);
+    shuffleDeck(game);
     
     // Play BlackJack and get result. True if player won, false if player lost
-    BlackJackResult result{ playBlackJack(deck) };
+    ConsoleSink sink{};
+    BlackJackResult result{ playBlackJack(game, sink) };
     
     if (result == BlackJackResult::player_won)
         cout << "\n[INFO] - Player won !" << "\n";
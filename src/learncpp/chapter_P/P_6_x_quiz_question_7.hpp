@@ -6,52 +6,21 @@
 //  Copyright © 2020 allwyn joseph. All rights reserved.
 //
 
+#include "../cards/cards.hpp"
+
+#include <cstdint>
 #include <iostream>
+#include <random>
 
 using namespace std;
 
 // Global constant expressions
-constexpr int cardsInADeck{ 52 };
-constexpr int cardInASuit{ 13 };
+constexpr int cardsInADeck{ cards::cardsInADeck };
 constexpr int blackJack{ 21 };
 constexpr int maxDealerValue{ 17 };
 
-enum class CardRank
-{
-    two,
-    three,
-    four,
-    five,
-    six,
-    seven,
-    eight,
-    nine,
-    ten,
-    jack,
-    queen,
-    king,
-    ace,
-    
-    max_rank
-};
-
-
-enum class CardSuits
-{
-    clubs,
-    diamonds,
-    hearts,
-    spades,
-    
-    max_suits
-};
-
-
-struct Card
-{
-    CardRank rank{};
-    CardSuits suit{};
-};
+// Cards, their ranks, suits and values come from the shared `cards` library
+using cards::Card;
 
 struct Player
 {
@@ -60,148 +29,114 @@ struct Player
 };
 
 /**
- * Returns a char indicating the rank of the card
- *
- * @param rank the rank of a card
+ * Returns user's desire to hit or stay.
  */
-char getCardRank(CardRank rank)
+char getUserResponse()
 {
-    switch(rank)
+    char hit_or_stay;
+    do
     {
-        case CardRank::two:
-            return '2';
-        case CardRank::three:
-            return '3';
-        case CardRank::four:
-            return '4';
-        case CardRank::five:
-            return '5';
-        case CardRank::six:
-            return '6';
-        case CardRank::seven:
-            return '7';
-        case CardRank::eight:
-            return '8';
-        case CardRank::nine:
-            return '9';
-        case CardRank::ten:
-            return 'T';
-        case CardRank::jack:
-            return 'J';
-        case CardRank::queen:
-            return 'Q';
-        case CardRank::king:
-            return 'K';
-        case CardRank::ace:
-            return 'A';
-        default:
-            return '0';
+        cout << "\n\t[UserInput] - Do you want to hit? (y/n): ";
+        cin >> hit_or_stay;
+        cin.ignore(32767, '\n');
     }
+    while (hit_or_stay != 'y' && hit_or_stay != 'n');
+    
+    return hit_or_stay;
 }
 
-
 /**
- * Returns a char indicating the suit of the card
- *
- * @param suit the suit of a card
+ * Asks the user whether to hit, whatever the score.
  */
-char getCardSuit(CardSuits suit)
+bool askUserToHit(int /*score*/)
 {
-    switch(suit)
-    {
-        case CardSuits::spades:
-            return 'S';
-        case CardSuits::hearts:
-            return 'H';
-        case CardSuits::diamonds:
-            return 'D';
-        case CardSuits::clubs:
-            return 'C';
-        default:
-            return 'Z';
-    }
+    return getUserResponse() == 'y';
 }
 
 /**
- * Creates a deck of cards.
+ * Hits below 17 like the dealer, for games played without a user.
  */
-auto createDeck()
+bool hitBelowSeventeen(int score)
 {
-    static Card arr[cardsInADeck];
-    
-    for(int s{0}; s < static_cast<int>(CardSuits::max_suits); s++)
-    {
-        for(int r{0}; r < static_cast<int>(CardRank::max_rank); r++)
-        {
-            arr[(s*cardInASuit) + r].suit = static_cast<CardSuits>(s);
-            arr[(s*cardInASuit) + r].rank = static_cast<CardRank>(r);
-        }
-    }
-    return arr;
+    return score < maxDealerValue;
 }
 
+
 /**
- * Returns value of card passed as an argument.
- *
- * @param card a struct holding card rank and suit
+ * Everything a game of blackjack needs: its deck, how far into the deck it
+ * has dealt, the engine shuffling the deck and how the player decides to
+ * hit. Nothing lives in statics, so any number of games can be played at
+ * the same time, each with its own state.
  */
-int getCardValue(const Card card)
+struct GameState
 {
-    switch(card.rank)
+    cards::FullDeck deck{ cards::orderedDeck };
+    int deck_index{ 0 };
+    mt19937 engine;
+    bool (*wantsHit)(int score){ askUserToHit };
+    
+    explicit GameState(mt19937::result_type seed = random_device{}())
+        : engine{ seed }
     {
-        case CardRank::two:
-            return 2;
-        case CardRank::three:
-            return 3;
-        case CardRank::four:
-            return 4;
-        case CardRank::five:
-            return 5;
-        case CardRank::six:
-            return 6;
-        case CardRank::seven:
-            return 7;
-        case CardRank::eight:
-            return 8;
-        case CardRank::nine:
-            return 9;
-        case CardRank::ten:
-        case CardRank::jack:
-        case CardRank::queen:
-        case CardRank::king:
-            return 10;
-        case CardRank::ace:
-            return 11;
-        default:
-            assert(false && "should never happen");
-            return '0';
     }
-}
+};
+
 
 /**
- * Returns user's desire to hit or stay.
+ * Prints the events of a game as they happen, the text the game has always
+ * shown on the console.
  */
-char getUserResponse()
+struct ConsoleSink
 {
-    char hit_or_stay;
-    do
+    void playerTurn()
     {
-        cout << "\n\t[UserInput] - Do you want to hit? (y/n): ";
-        cin >> hit_or_stay;
-        cin.ignore(32767, '\n');
+        cout << "\n\n[INFO] - It's the player's chance to play first.";
     }
-    while (hit_or_stay != 'y' && hit_or_stay != 'n');
     
-    return hit_or_stay;
-}
+    void dealerTurn()
+    {
+        cout << "\n\n[INFO] - The dealer will now play until 17 or bust.";
+    }
+    
+    /**
+     * Displays the score of the player or dealer after a card
+     *
+     * @param total the score so far
+     * @param dealerIsPlaying a bool indicating if the dealer or player is playing
+     */
+    void scoreChanged(int total, bool dealerIsPlaying)
+    {
+        if (dealerIsPlaying)
+            cout << "\n\t[INFO] - dealer's score: " << total;
+        else
+            cout << "\n\t[INFO] - player's score: " << total;
+    }
+    
+    /**
+     * Displays player's and dealer's total card value
+     *
+     * @param playerValue an int indicating player's card value
+     * @param dealerValue an int indicating dealer's card value, 0 if the
+     *      player went bust before the dealer played
+     */
+    void valuesCompared(int playerValue, int dealerValue)
+    {
+        cout << "\n\n[INFO] - Player's total card value = " << playerValue;
+        cout << "\n[INFO] - Dealer's total card value = " << dealerValue;
+    }
+};
 
-void displayPlayerScore(int total, bool dealerIsPlaying = false)
+/**
+ * Ignores every event. Its members do nothing and are inlined away, so a
+ * game played with it runs without any output code, e.g. in `playManyGames`.
+ */
+struct NullSink
 {
-    if (dealerIsPlaying)
-        cout << "\n\t[INFO] - dealer's score: " << total;
-    else
-        cout << "\n\t[INFO] - player's score: " << total;
-}
+    void playerTurn() {}
+    void dealerTurn() {}
+    void scoreChanged(int, bool) {}
+    void valuesCompared(int, int) {}
+};
 
 
 /**
@@ -213,8 +148,8 @@ void displayPlayerScore(int total, bool dealerIsPlaying = false)
 void checkAcesUpdatePlayer(Player &player, Card &card)
 {
     // Update player score and ace count
-    player.score += getCardValue(card);
-    if (getCardRank(card.rank) == 'A')
+    player.score += card.value();
+    if (card.rank() == Card::rank_ace)
         player.ace_count += 1;
     
     // Check if player score is greater than 21, if so decrease score by
@@ -226,29 +161,39 @@ void checkAcesUpdatePlayer(Player &player, Card &card)
     }
 }
 
+/**
+ * Returns the card at the game's deck index, starting over from the top of
+ * the deck once the end has been reached.
+ *
+ * @param game the state of the game being played
+ */
+Card &currentCard(GameState &game)
+{
+    if (game.deck_index >= cardsInADeck)
+        game.deck_index = 0;
+    return game.deck[game.deck_index];
+}
+
 /**
  * Returns total score of cards drawn by dealer or player.
  *
- * @param deck an array of structs holding different cards and the rank and suit
- *      they belong to
+ * @param game the state of the game being played, its deck index moves past
+ *      the cards drawn
+ * @param sink receives the score after every card
  * @param dealerIsPlaying a bool indicating if the dealer or player is playing
  */
-int play(Card deck[], bool dealerIsPlaying = false)
+template <typename Sink>
+int play(GameState &game, Sink &sink, bool dealerIsPlaying = false)
 {
     // Initialize player
     Player player;
     
-    // Keep track of deck index and re-initialize if value reachess 51
-    static int deck_index{ 0 };
-    if (deck_index == 52)
-        deck_index = 0;
-    
     // If dealer, pick one card from deck, else pick two cards
-    checkAcesUpdatePlayer(player, deck[deck_index]);
+    checkAcesUpdatePlayer(player, currentCard(game));
     if (not dealerIsPlaying)
-        ++deck_index;
-    checkAcesUpdatePlayer(player, deck[deck_index]);
-    displayPlayerScore(player.score, dealerIsPlaying);
+        ++game.deck_index;
+    checkAcesUpdatePlayer(player, currentCard(game));
+    sink.scoreChanged(player.score, dealerIsPlaying);
     
     bool keepPlaying{ 1 };
     
@@ -260,8 +205,8 @@ int play(Card deck[], bool dealerIsPlaying = false)
         {
             if (player.score < maxDealerValue)
             {
-                checkAcesUpdatePlayer(player, deck[deck_index]);
-                displayPlayerScore(player.score, dealerIsPlaying);
+                checkAcesUpdatePlayer(player, currentCard(game));
+                sink.scoreChanged(player.score, dealerIsPlaying);
             }
             else
                 keepPlaying = 0;
@@ -272,10 +217,10 @@ int play(Card deck[], bool dealerIsPlaying = false)
         {
             if (player.score < blackJack)
             {
-                if (getUserResponse() == 'y')
+                if (game.wantsHit(player.score))
                 {
-                    checkAcesUpdatePlayer(player, deck[deck_index]);
-                    displayPlayerScore(player.score, dealerIsPlaying);
+                    checkAcesUpdatePlayer(player, currentCard(game));
+                    sink.scoreChanged(player.score, dealerIsPlaying);
                 }
                 else
                     keepPlaying = 0;
@@ -283,7 +228,7 @@ int play(Card deck[], bool dealerIsPlaying = false)
             else
                 keepPlaying = 0;
         }
-        ++deck_index;
+        ++game.deck_index;
         
     }
     return player.score;
@@ -0,0 +1,148 @@
+//
+//  P_6_x_quiz_question_7_casino.cpp
+//  learncpp
+//
+//  Created by allwyn joseph on 10/18/26.
+//  Copyright © 2026 allwyn joseph. All rights reserved.
+//
+
+#include "P_6_x_quiz_question_7_complex.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+
+class ThreadPool
+{
+    /*
+     Fixed set of worker threads running the tasks pushed to a shared queue
+    */
+
+private:
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_taskReady;
+    std::condition_variable m_allDone;
+    int m_pending{ 0 };
+    bool m_stopping{ false };
+
+    void work()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock{ m_mutex };
+                m_taskReady.wait(lock, [this]() { return m_stopping or not m_tasks.empty(); });
+                if (m_tasks.empty())
+                    return;
+                task = std::move(m_tasks.front());
+                m_tasks.pop();
+            }
+
+            task();
+
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            if (--m_pending == 0)
+                m_allDone.notify_all();
+        }
+    }
+
+public:
+    explicit ThreadPool(int num_threads)
+    {
+        for (int i{ 0 }; i < num_threads; i++)
+            m_workers.emplace_back(&ThreadPool::work, this);
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            m_stopping = true;
+        }
+        m_taskReady.notify_all();
+        for (auto& worker : m_workers)
+            worker.join();
+    }
+
+    void push(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            m_tasks.push(std::move(task));
+            ++m_pending;
+        }
+        m_taskReady.notify_one();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock{ m_mutex };
+        m_allDone.wait(lock, [this]() { return m_pending == 0; });
+    }
+};
+
+
+// Usage: P_6_x_quiz_question_7_casino [tables] [seats per table] [rounds] [threads, 0 for one per core]
+int main(int argc, char* argv[])
+{
+    int num_tables{ std::max(0, argc > 1 ? std::atoi(argv[1]) : 5000) };
+    int num_seats{ std::max(0, argc > 2 ? std::atoi(argv[2]) : 5) };
+    int num_rounds{ argc > 3 ? std::atoi(argv[3]) : 1000 };
+    int num_threads{ argc > 4 ? std::atoi(argv[4]) : 0 };
+    
+    // A pool without workers would never finish a task
+    if (num_threads <= 0)
+        num_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    // Every table owns its deck, seats and dealer, seeded by its number
+    std::vector<TableSession> tables;
+    tables.reserve(num_tables);
+    for (int t{ 0 }; t < num_tables; t++)
+        tables.emplace_back(num_seats, static_cast<std::mt19937::result_type>(t + 1));
+
+    // Tables advance a slice of rounds per task, so all of them make
+    // progress side by side instead of one table finishing first
+    constexpr int rounds_per_task{ 50 };
+
+    auto start{ std::chrono::steady_clock::now() };
+    {
+        ThreadPool pool{ num_threads };
+        for (int done{ 0 }; done < num_rounds; done += rounds_per_task)
+        {
+            int rounds{ std::min(rounds_per_task, num_rounds - done) };
+            for (auto& table : tables)
+                pool.push([&table, rounds]()
+                {
+                    for (int r{ 0 }; r < rounds; r++)
+                        table.playRound();
+                });
+            pool.wait();
+        }
+    }
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    SessionStats total{};
+    for (const auto& table : tables)
+        total += table.stats();
+
+    long long seat_rounds{ total.wins + total.ties + total.losses };
+    std::cout << "[INFO] - Tables played       : " << num_tables << " x " << num_seats << " seats\n";
+    std::cout << "[INFO] - Rounds per table    : " << num_rounds << "\n";
+    std::cout << "[INFO] - Seat wins/ties/lost : " << total.wins << " / " << total.ties << " / " << total.losses << "\n";
+    std::cout << "[INFO] - Seat EV             : "
+              << (seat_rounds ? static_cast<double>(total.wins - total.losses) / seat_rounds : 0.0) << "\n";
+    std::cout << "[INFO] - Rounds / second     : " << static_cast<long long>(total.rounds / elapsed.count()) << "\n";
+
+    return 0;
+}
@@ -9,9 +9,17 @@
 #ifndef P_6_x_quiz_question_7_hpp
 #define P_6_x_quiz_question_7_hpp
 
+#include "../cards/cards.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <ctime>
 #include <iostream>
 #include <random>
-#include <array>
+#include <string>
+#include <vector>
 
 
 #endif /* P_6_x_quiz_question_7_hpp */
@@ -23,139 +31,33 @@ constexpr int maximumScore{ 21 };
 constexpr int minimumDealerScore{ 17 };
 
 
-enum class Ranks
-{
-    // Enum object representing the
-    // values of cards in a deck
-    TWO,
-    THREE,
-    FOUR,
-    FIVE,
-    SIX,
-    SEVEN,
-    EIGHT,
-    NINE,
-    TEN,
-    JACK,
-    QUEEN,
-    KING,
-    ACE,
-    TOTAL,
-};
-
-enum class Suits
-{
-    // Enum object representing 
-    HEARTS,
-    SPADES,
-    DIAMONDS,
-    CLUBS,
-    TOTAL,
-    
-};
-
-struct Card
-{
-    Ranks rank{};
-    Suits suit{};
-};
+// One card model for all the games, see cards.hpp
+using cards::Card;
 
 struct Player
 {
     int final_value{ 0 };
     std::string name;
     std::vector<int> cards;
-    std::vector<int> values;
+    
+    // Running count of the hand: total with every ace counted as 1 and the
+    // number of aces, from which every possible total follows
+    int hard_total{ 0 };
+    int ace_count{ 0 };
+    
+    // Aces, by the order they were counted in, that count as 11 in every
+    // total (see getCount()); hard_total already holds them as 11
+    std::uint32_t fixed_aces{ 0 };
 };
 
 using player_type = std::vector<Player>;
 
-using deck_type = std::array<Card, 52>;
-
-
-void createDeck(deck_type& deck)
-{
-    int diff{0};
-    auto suits{ static_cast<int>(Suits::TOTAL) };
-    auto ranks{ static_cast<int>(Ranks::TOTAL) };
-    
-    for (int s{0}; s < suits; s++)
-    {
-        diff = s*ranks;
-        for (int r{0}; r < ranks; r++)
-        {
-            deck[diff +r].rank = static_cast<Ranks>(r);
-            deck[diff +r].suit = static_cast<Suits>(s);
-        }
-    }
-}
+using deck_type = cards::FullDeck;
 
 
 void printCard(const Card card)
 {
-    
-    switch (card.rank) {
-        case Ranks::TWO:
-            std::cout << "2";
-            break;
-        case Ranks::THREE:
-            std::cout << "3";
-            break;
-        case Ranks::FOUR:
-            std::cout << "4";
-            break;
-        case Ranks::FIVE:
-            std::cout << "5";
-            break;
-        case Ranks::SIX:
-            std::cout << "6";
-            break;
-        case Ranks::SEVEN:
-            std::cout << "7";
-            break;
-        case Ranks::EIGHT:
-            std::cout << "8";
-            break;
-        case Ranks::NINE:
-            std::cout << "9";
-            break;
-        case Ranks::TEN:
-            std::cout << "T";
-            break;
-        case Ranks::JACK:
-            std::cout << "J";
-            break;
-        case Ranks::QUEEN:
-            std::cout << "Q";
-            break;
-        case Ranks::KING:
-            std::cout << "K";
-            break;
-        case Ranks::ACE:
-            std::cout << "A";
-            break;
-        default:
-            break;
-    }
-    
-    switch (card.suit)
-    {
-        case Suits::HEARTS:
-            std::cout << "H";
-            break;
-        case Suits::SPADES:
-            std::cout << "S";
-            break;
-        case Suits::DIAMONDS:
-            std::cout << "D";
-            break;
-        case Suits::CLUBS:
-            std::cout << "C";
-            break;
-            
-        default:
-            break;
-    }
+    card.print();
 }
 
 
@@ -168,9 +70,8 @@ void printDeck(const deck_type deck)
     }
 }
 
-void shuffleDeck(deck_type& deck)
+void shuffleDeck(deck_type& deck, std::mt19937& mt)
 {
-    static std::mt19937 mt{ static_cast<std::mt19937::result_type>(std::time(nullptr)) };
     std::shuffle(deck.begin(), deck.end(), mt);
 }
 
@@ -178,119 +79,94 @@ void shuffleDeck(deck_type& deck)
 void getCount(Player& player)
 {
     /*
-     Function to get player counts at the beginning of the game
+     Function to add the cards hit since the last call to the player's count.
+     
+     The game has always counted an ace after the first one added in the
+     same call as 11 in every total, so an A-A opening hand is 12 or 22
+     rather than 2 or 12 and a ten on top of it busts. Such aces are kept
+     as 11 here to play and show hands as before.
     */
     
-    int ace_value{ 1 };
-    std::string msg{};
-    
-    // If `values` vector empty add an element to it. At the beginning
-    // of the game the vector is empty.
-    if (not player.values.size())
-        player.values.push_back(static_cast<int>(0));
-    
+    bool ace_added{ false };
     for (int card : player.cards)
     {
-        // The case where card count is less than 10.
-        if (card <= static_cast<int>(Ranks::TEN))
+        // The case where an ACE is picked, counted as 1 here and as 11 only
+        // when a total is asked for
+        if (card == Card::rank_ace)
         {
-            // Increase value of all elements in `values` vector
-            // by the card value that has just been hit.
-            for (int& value : player.values)
-            {
-//                std::cout << "Before" << value << std::endl;
-                value += card + 2;
-//                std::cout << "After" << value << std::endl;
-            }
-            
-        }
-        
-        // The case where an ACE is picked
-        else if (card == static_cast<int>(Ranks::ACE))
-        {
-            std::vector<int> temp_values{ player.values };
-            
-            // Double the length of `values` vector by copying all elements
-            // within it twice. Ex: [4,2] -> [4,2,4,2]
-            for (int temp_value : temp_values)
-                player.values.push_back(static_cast<int>(temp_value));
-            
-            // Add 1 to the first half of the `values` vector add 11 to the
-            // second half
-            for (int i{0}; i < player.values.size(); i++)
+            if (ace_added)
             {
-                // Incrase the value of ace to 11 for the second half of the
-                // vector
-                if (i > (player.values.size())/2 - 1)
-                   ace_value = 11;
-                
-                // Add value of ace to element of vector `values`
-                player.values[i] += ace_value;
+                player.hard_total += 11;
+                player.fixed_aces |= 1u << player.ace_count;
             }
+            else
+                player.hard_total += 1;
+            player.ace_count += 1;
+            ace_added = true;
         }
         
-        // The case where JACK, QUEEN or KING is picked
+        // Any other card counts its value
         else
-        {
-            switch (card)
-            {
-                case static_cast<int>(Ranks::JACK):
-                case static_cast<int>(Ranks::QUEEN):
-                case static_cast<int>(Ranks::KING):
-                    for (int& value : player.values)
-                        value += 10;
-                    break;
-                // Basically should never happen
-                default:
-                    for (int value : player.values)
-                        value += 1000000;
-            }
-        }
-        
+            player.hard_total += cards::rankValues[card];
     }
     // Delete cards once the value is recorded
-    player.cards.erase(player.cards.begin(), player.cards.end());
+    player.cards.clear();
+}
+
 
+bool hasUsableAce(const Player& player)
+{
+    // One ace counted as 11 instead of 1 adds 10 without going bust
+    int soft_aces{ player.ace_count - static_cast<int>(std::bitset<32>{ player.fixed_aces }.count()) };
+    return soft_aces > 0 and player.hard_total + 10 <= maximumScore;
 }
 
+
 void h_P_Assign(Player& player)
 {
-    int selected_value{ 0 };
-    
-    for (int value : player.values)
-    {
-        if (value > selected_value and value < 22)
-            selected_value = value;
-        else if (not selected_value)
-            selected_value = value;
-    }
-    
-    player.final_value = selected_value;
+    // Best total: use an ace as 11 if that does not bust the hand
+    player.final_value = player.hard_total + (hasUsableAce(player) ? 10 : 0);
 }
 
 
 
-bool check(Player player)
+bool check(const Player& player)
 {
 
-    if (player.values[0] > maximumScore)
+    if (player.hard_total > maximumScore)
         return 0;
     return 1;
 }
 
 
-void print_PlayerStats(std::vector<int> player_values)
+void print_PlayerStats(const Player& player, bool only_valid = false)
 {
     /*
-     Function that prints total card value of players
+     Function that prints total card value of players.
+     
+     Totals are listed in the order the hand's possible totals have always
+     been shown: entry i counts as many aces as 11 as i has bits set, aces
+     in `fixed_aces` aside, so each ace doubles the list. With `only_valid`
+     only totals up to 21 are shown.
      */
     
-    // Display player / dealer stats
-    for (int i{ 0 }; i < player_values.size(); i++)
-        if (i)
-            std::cout <<" or " << player_values[i];
-        else if (not i)
-            std::cout << player_values[i];
+    bool first{ true };
+    auto print_value = [&first](int value)
+    {
+        if (not first)
+            std::cout <<" or " << value;
+        else
+            std::cout << value;
+        first = false;
+    };
+    
+    for (std::uint32_t i{ 0 }; i < (1u << player.ace_count); i++)
+    {
+        int elevens{ static_cast<int>(std::bitset<32>{ i & ~player.fixed_aces }.count()) };
+        int value{ player.hard_total + 10 * elevens };
+        if (not only_valid or value <= maximumScore)
+            print_value(value);
+    }
     std::cout << std::endl;
 }
 
@@ -303,3 +179,270 @@ std::string getPlayerName(int count)
     
     return name;
 }
+
+
+// How a round ended for a seat
+enum class SeatResult
+{
+    won,
+    tie,
+    lost
+};
+
+
+struct ConsoleTableSink
+{
+    /*
+     Prints the events of a table as they happen, the text the interactive
+     game has always shown
+    */
+    
+    void dealerSeated()
+    {
+        std::cout << "Initializing Dealer .. \n";
+    }
+    
+    void cardDealt(const Player& /*player*/, int card)
+    {
+        // Display value of the card hit
+        if (card < 8)
+            std::cout << "\t Card value hit : " << card + 2 << std::endl;
+        else if (card < 12)
+            std::cout << "\t Card value hit : 10 " << std::endl;
+        else
+            std::cout << "\t Card value hit : 1 or 11" << std::endl;
+    }
+    
+    void turnStarted(const Player& player)
+    {
+        std::cout << "\n" << player.name << " it's your turn to hit or stay \n";
+        std::cout << "\t Your current card count is/are : " ;
+        print_PlayerStats(player);
+    }
+    
+    void handChanged(const Player& player)
+    {
+        // Check if player / dealer has gone bust, else display the totals
+        // that are still less than or equal to 21
+        if (not check(player))
+            std::cout << "\t You have gone BUST!!! \n";
+        else
+        {
+            std::cout <<"\t Your new card count(s) is/are : " ;
+            print_PlayerStats(player, true);
+        }
+    }
+    
+    void turnEnded(const Player& player)
+    {
+        std::cout << "\t Your final value is : " << player.final_value << std::endl;
+    }
+    
+    void seatSettled(const Player& player, SeatResult result)
+    {
+        if (result == SeatResult::won)
+            std::cout << player.name << ", winner, winner, chicken dinner! \n";
+        else if (result == SeatResult::tie)
+            std::cout << player.name << ", it's a Tie! \n";
+        else
+            std::cout << player.name << ", Dealer has beat you ... \n";
+    }
+};
+
+
+struct NullTableSink
+{
+    /*
+     Ignores every event. The members are empty, so a round played with
+     this sink compiles to the game logic alone
+    */
+    
+    void dealerSeated() {}
+    void cardDealt(const Player&, int) {}
+    void turnStarted(const Player&) {}
+    void handChanged(const Player&) {}
+    void turnEnded(const Player&) {}
+    void seatSettled(const Player&, SeatResult) {}
+};
+
+
+// Totals of the rounds played at a table, from the seats' point of view.
+struct SessionStats
+{
+    long long rounds{ 0 };
+    long long wins{ 0 };
+    long long ties{ 0 };
+    long long losses{ 0 };
+    
+    SessionStats& operator+=(const SessionStats& other)
+    {
+        rounds += other.rounds;
+        wins += other.wins;
+        ties += other.ties;
+        losses += other.losses;
+        return *this;
+    }
+};
+
+
+class TableSession
+{
+    /*
+     One blackjack table: its own deck and dealing position, its own random
+     engine, its seats and its dealer (always the last entry of `players`).
+     Nothing is shared with any other table, so many sessions can be played
+     at the same time from different threads.
+    */
+    
+private:
+    deck_type m_deck{ cards::orderedDeck };
+    int m_track{ 0 };
+    std::mt19937 m_engine;
+    player_type m_players;
+    SessionStats m_stats{};
+    
+public:
+    explicit TableSession(std::mt19937::result_type seed)
+        : m_engine{ seed }
+    {
+        shuffleDeck(m_deck, m_engine);
+    }
+    
+    TableSession(int num_seats, std::mt19937::result_type seed)
+        : TableSession(seed)
+    {
+        seatPlayers(num_seats);
+    }
+    
+    void seatPlayers(int num_seats)
+    {
+        // One player per seat and the dealer in the last position
+        m_players.assign(num_seats + 1, Player{});
+        m_players.back().name = "Dealer";
+    }
+    
+    player_type& players() { return m_players; }
+    const player_type& players() const { return m_players; }
+    Player& dealer() { return m_players.back(); }
+    const SessionStats& stats() const { return m_stats; }
+    
+    void deal(std::vector<int>& cards, int times)
+    {
+        /*
+         Function to deal `times` cards into `cards`, shuffling and starting
+         over once one has reached the end of the set of cards
+        */
+        for (int i{0}; i < times; i++)
+        {
+            if (m_track >= 51)
+            {
+                shuffleDeck(m_deck, m_engine);
+                m_track = 0;
+            }
+            cards.push_back(static_cast<int>(m_deck[m_track].rank()));
+            m_track++;
+        }
+    }
+    
+    template <typename Sink>
+    void dealOpening(Player& player, Sink& sink)
+    {
+        /*
+         Starts a player's hand: two cards for a seat, one for the dealer
+         who draws the rest on its turn
+        */
+        bool is_dealer{ &player == &dealer() };
+        if (is_dealer)
+            sink.dealerSeated();
+        
+        player.cards.clear();
+        player.hard_total = 0;
+        player.ace_count = 0;
+        player.fixed_aces = 0;
+        deal(player.cards, is_dealer ? 1 : 2);
+        for (int card : player.cards)
+            sink.cardDealt(player, card);
+        
+        getCount(player);
+        h_P_Assign(player);
+    }
+    
+    template <typename Sink>
+    void hitAndCount(Player& player, Sink& sink)
+    {
+        // Deal one card and fold it straight into the player's count
+        deal(player.cards, 1);
+        sink.cardDealt(player, player.cards.back());
+        getCount(player);
+        h_P_Assign(player);
+        sink.handChanged(player);
+    }
+    
+    template <typename Sink, typename WantsHit>
+    void playSeat(Player& player, Sink& sink, WantsHit&& wantsHit)
+    {
+        // The seat hits for as long as `wantsHit(player)` says so, or until bust
+        sink.turnStarted(player);
+        while (check(player) and wantsHit(player))
+            hitAndCount(player, sink);
+        h_P_Assign(player);
+        sink.turnEnded(player);
+    }
+    
+    template <typename Sink>
+    void playDealer(Sink& sink)
+    {
+        // The dealer draws at least one card, then until 17 or bust
+        sink.turnStarted(dealer());
+        do
+            hitAndCount(dealer(), sink);
+        while (dealer().final_value < minimumDealerScore and check(dealer()));
+        sink.turnEnded(dealer());
+    }
+    
+    template <typename Sink>
+    void settle(Sink& sink)
+    {
+        // Every seat against the dealer; a bust seat only ties a bust dealer
+        int dealer_value{ dealer().final_value < 22 ? dealer().final_value : 0 };
+        for (std::size_t i{ 0 }; i + 1 < m_players.size(); i++)
+        {
+            int player_value{ m_players[i].final_value };
+            SeatResult result{ SeatResult::lost };
+            if (player_value < 22 and player_value > dealer_value)
+                result = SeatResult::won;
+            else if ((player_value < 22 and player_value == dealer_value) or
+                     (player_value >= 22 and dealer_value == 0))
+                result = SeatResult::tie;
+            
+            if (result == SeatResult::won)
+                ++m_stats.wins;
+            else if (result == SeatResult::tie)
+                ++m_stats.ties;
+            else
+                ++m_stats.losses;
+            sink.seatSettled(m_players[i], result);
+        }
+        ++m_stats.rounds;
+    }
+    
+    template <typename Sink = NullTableSink>
+    void playRound(int seat_stands_on = minimumDealerScore, Sink&& sink = {})
+    {
+        /*
+         Plays one round without any input: every seat hits until
+         `seat_stands_on` or bust, then the dealer plays as in the
+         interactive game and the seats are settled against the dealer.
+         With the default sink nothing is printed either.
+        */
+        for (auto& player : m_players)
+            dealOpening(player, sink);
+        
+        auto below_stand{ [seat_stands_on](const Player& player) { return player.final_value < seat_stands_on; } };
+        for (std::size_t i{ 0 }; i + 1 < m_players.size(); i++)
+            playSeat(m_players[i], sink, below_stand);
+        
+        playDealer(sink);
+        settle(sink);
+    }
+};